@@ -0,0 +1,117 @@
+/* ==============================================================================
+ * Archivo: bench_bulk_io.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Mide la E/S masiva de ficheros con un uint128_t por línea
+ * (`io/bulk_io.hpp`):
+ * - Escritura: bucle `std::ofstream << valor << '\n'` frente a
+ *   `write_integers` (1 hilo / todos).
+ * - Lectura: bucle `std::ifstream >> valor` frente a `read_integers`
+ *   (mmap, 1 hilo / todos).
+ *
+ * Uso: bench_bulk_io [líneas]   (por defecto 2 * 10^6, ~75 MB)
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/numeric_io.hpp>
+#include <numbers_calculations/io/bulk_io.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib> // Para std::strtoull
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace numbers_calculations;
+using core::uint128_t;
+using core::operator<<;
+using core::operator>>;
+
+namespace {
+
+std::uint64_t next_random(std::uint64_t &state) {
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return state;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t lines =
+      argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10))
+               : 2000000;
+  const std::string path =
+      (std::filesystem::temp_directory_path() / "bench_bulk_io.txt").string();
+
+  std::vector<uint128_t> values(lines);
+  std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (auto &v : values) {
+    v = ((uint128_t{next_random(state)} << 64) | next_random(state)) >>
+        (next_random(state) % 64);
+  }
+  math::ParallelConfig serial;
+  serial.thread_count = 1;
+
+  const double t_ostream = bench::best_time_ms(
+      [&] {
+        std::ofstream out(path);
+        for (const uint128_t v : values) {
+          out << v << '\n';
+        }
+      },
+      1);
+  const double t_write_serial = bench::best_time_ms(
+      [&] {
+        bench::consume_checksum(
+            io::write_integers(path, values, serial).value());
+      },
+      1);
+  const double t_write = bench::best_time_ms(
+      [&] {
+        bench::consume_checksum(io::write_integers(path, values).value());
+      },
+      1);
+
+  const double t_istream = bench::best_time_ms(
+      [&] {
+        std::ifstream in(path);
+        std::vector<uint128_t> column;
+        column.reserve(lines);
+        uint128_t v = 0;
+        while (in >> v) {
+          column.push_back(v);
+        }
+        bench::consume_checksum(column.size());
+      },
+      1);
+  const double t_read_serial = bench::best_time_ms(
+      [&] {
+        bench::consume_checksum(
+            io::read_integers<uint128_t>(path, serial).value().values.size());
+      },
+      1);
+  const double t_read = bench::best_time_ms(
+      [&] {
+        bench::consume_checksum(
+            io::read_integers<uint128_t>(path).value().values.size());
+      },
+      1);
+  const double mb =
+      static_cast<double>(std::filesystem::file_size(path)) / 1e6;
+  std::remove(path.c_str());
+
+  std::printf("# Benchmark: %zu líneas de uint128_t (%.0f MB)\n\n", lines, mb);
+  bench::print_table_header({"operación", "stream (ms)", "bulk 1 hilo (ms)",
+                             "bulk todos (ms)", "speedup", "MB/s"});
+  std::printf("| escritura | %.0f | %.0f | %.0f | %.1fx | %.0f |\n", t_ostream,
+              t_write_serial, t_write, t_ostream / t_write, mb / t_write * 1e3);
+  std::printf("| lectura | %.0f | %.0f | %.0f | %.1fx | %.0f |\n", t_istream,
+              t_read_serial, t_read, t_istream / t_read, mb / t_read * 1e3);
+  return 0;
+}
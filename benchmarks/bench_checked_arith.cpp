@@ -0,0 +1,115 @@
+/* ==============================================================================
+ * Archivo: bench_checked_arith.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Mide el coste por llamada de la comprobación de overflow en un producto:
+ * - División previa (`a > max / b`), el patrón anterior de `math/`.
+ * - `core::mul_overflow` (flag de la multiplicación vía intrínsecos).
+ *
+ * Cada medida multiplica pares de operandos pseudoaleatorios (buena parte de
+ * los productos desborda) y suma los flags sin saltos, para que el compilador
+ * no pueda eliminar nada y los fallos de predicción no tapen la diferencia.
+ *
+ * Uso: bench_checked_arith
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/core/checked_arith.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+
+#include <algorithm> // Para std::rotate
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+using namespace numbers_calculations;
+
+namespace {
+
+constexpr std::size_t OPERANDS = 1 << 16;
+constexpr int PASSES = 200;
+
+// Operandos de la mitad de bits del tipo (+-1 bit).
+template <typename T> std::vector<T> make_operands() {
+  std::vector<T> values(OPERANDS);
+  std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  constexpr int half_bits = std::numeric_limits<T>::digits / 2;
+  for (T &v : values) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    T x = static_cast<T>(state >> 1);
+    if constexpr (sizeof(T) > 8) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      x = (x << 64) | static_cast<T>(state);
+    }
+    x >>= std::numeric_limits<T>::digits - half_bits - 1 - (state & 1);
+    v = x | 1;
+  }
+  return values;
+}
+
+template <typename T>
+std::size_t count_division(const std::vector<T> &a, const std::vector<T> &b) {
+  std::size_t overflows = 0;
+  T sink = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    overflows += a[i] > std::numeric_limits<T>::max() / b[i];
+    sink ^= a[i] * b[i];
+  }
+  bench::do_not_optimize(sink);
+  return overflows;
+}
+
+template <typename T>
+std::size_t count_intrinsic(const std::vector<T> &a, const std::vector<T> &b) {
+  std::size_t overflows = 0;
+  T sink = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    T product{};
+    overflows += core::mul_overflow(a[i], b[i], product);
+    sink ^= product;
+  }
+  bench::do_not_optimize(sink);
+  return overflows;
+}
+
+template <typename T> void run(const char *name) {
+  const auto a = make_operands<T>();
+  auto b = make_operands<T>();
+  std::rotate(b.begin(), b.begin() + 1, b.end());
+
+  std::size_t overflows = 0;
+  const double t_div = bench::best_time_ms([&] {
+    for (int p = 0; p < PASSES; ++p) {
+      overflows = count_division(a, b);
+    }
+  });
+  const double t_int = bench::best_time_ms([&] {
+    for (int p = 0; p < PASSES; ++p) {
+      bench::do_not_optimize(count_intrinsic(a, b));
+    }
+  });
+
+  const double calls = static_cast<double>(OPERANDS) * PASSES;
+  std::printf("| %s | %.1f%% | %.2f | %.2f | %.1fx |\n", name,
+              100.0 * static_cast<double>(overflows) / OPERANDS,
+              t_div * 1e6 / calls, t_int * 1e6 / calls, t_div / t_int);
+}
+
+} // namespace
+
+int main() {
+  std::printf("# Benchmark: comprobación de overflow en a * b\n\n");
+  bench::print_table_header({"tipo", "overflows", "división (ns/llamada)",
+                             "mul_overflow (ns/llamada)", "speedup"});
+  run<std::uint32_t>("uint32_t");
+  run<std::uint64_t>("uint64_t");
+  run<std::int64_t>("int64_t");
+#if HAS_NATIVE_INT128
+  run<core::uint128_t>("uint128_t");
+#endif
+  return 0;
+}
@@ -0,0 +1,67 @@
+/* ==============================================================================
+ * Archivo: bench_factorial.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Compara los algoritmos de factorial para `cpp_int`:
+ * - Bucle lineal (el algoritmo de `internal::constexpr_factorial`).
+ * - Árbol de productos balanceado (`internal::product_range`).
+ * - Prime-swing de Luschny (`internal::prime_swing_factorial`).
+ * - Árbol de productos multihilo (`factorial(n, ParallelConfig)`).
+ *
+ * Uso: bench_factorial [hilos]   (0 o sin argumento = todos los núcleos)
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/math/combinatorics.hpp>
+#include <numbers_calculations/math/parallel_product.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib> // Para std::atoi
+
+using namespace numbers_calculations;
+namespace mp = boost::multiprecision;
+
+// `constexpr_factorial` no admite `cpp_int` (su chequeo de overflow usa
+// numeric_limits<cpp_int>::max(), que vale 0), así que reproducimos aquí su
+// bucle sin el chequeo para tener la referencia lineal.
+static mp::cpp_int linear_factorial(std::uint64_t n) {
+  mp::cpp_int result = 1;
+  for (std::uint64_t i = 2; i <= n; ++i) {
+    result *= i;
+  }
+  return result;
+}
+
+int main(int argc, char **argv) {
+  math::ParallelConfig config;
+  config.thread_count = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : 0;
+
+  std::printf("# Benchmark: factorial (cpp_int), hilos = %u\n\n",
+              math::internal::resolve_thread_count(config.thread_count));
+  bench::print_table_header({"n", "lineal (ms)", "árbol (ms)",
+                             "prime-swing (ms)", "multihilo (ms)",
+                             "speedup vs lineal"});
+
+  for (std::uint64_t n : {1000u, 10000u, 50000u, 100000u, 200000u}) {
+    const double t_linear =
+        bench::best_time_ms([&] { bench::do_not_optimize(linear_factorial(n)); }, 1);
+    const double t_tree = bench::best_time_ms([&] {
+      bench::do_not_optimize(math::internal::product_range<mp::cpp_int>(2, n));
+    });
+    const double t_swing = bench::best_time_ms([&] {
+      bench::do_not_optimize(
+          math::internal::prime_swing_factorial<mp::cpp_int>(n));
+    });
+    const double t_parallel = bench::best_time_ms([&] {
+      bench::do_not_optimize(math::factorial(mp::cpp_int(n), config));
+    });
+
+    std::printf("| %llu | %.3f | %.3f | %.3f | %.3f | %.1fx |\n",
+                static_cast<unsigned long long>(n), t_linear, t_tree, t_swing,
+                t_parallel, t_linear / t_parallel);
+  }
+  return 0;
+}
@@ -0,0 +1,124 @@
+/* ==============================================================================
+ * Archivo: bench_factorize.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Mide el coste de `math::factorize`:
+ * - Claves aleatorias de 40 bits: división por tentativa hasta sqrt(n)
+ *   (la alternativa habitual) frente a división rápida + rho de Brent.
+ * - Claves aleatorias de 64 bits y semiprimos de dos primos de 32 bits
+ *   (el peor caso del rho en 64 bits).
+ * - `factorize_batch` con 1 hilo y con todos.
+ *
+ * Uso: bench_factorize
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/math/factorization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace numbers_calculations;
+
+namespace {
+
+std::uint64_t next_random(std::uint64_t &state) {
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return state;
+}
+
+std::vector<std::uint64_t> make_keys(std::size_t count, int bits) {
+  std::vector<std::uint64_t> keys(count);
+  std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (auto &k : keys) {
+    k = (next_random(state) >> (64 - bits)) | 1;
+  }
+  return keys;
+}
+
+std::vector<std::uint64_t> make_semiprimes(std::size_t count) {
+  std::vector<std::uint64_t> keys;
+  std::uint64_t state = 0x2545F4914F6CDD1DULL;
+  while (keys.size() < count) {
+    const std::uint64_t p = (next_random(state) >> 32) | 1;
+    const std::uint64_t q = (next_random(state) >> 32) | 1;
+    if (math::is_prime(p) && math::is_prime(q)) {
+      keys.push_back(p * q);
+    }
+  }
+  return keys;
+}
+
+// División por tentativa: 2 y los impares hasta sqrt(n)
+std::uint64_t trial_division_exponents(std::uint64_t n) {
+  std::uint64_t exponents = 0;
+  for (std::uint64_t d = 2; d * d <= n; d += (d == 2 ? 1 : 2)) {
+    while (n % d == 0) {
+      n /= d;
+      ++exponents;
+    }
+  }
+  return exponents + (n > 1);
+}
+
+std::uint64_t factorize_exponents(std::uint64_t n) {
+  std::uint64_t exponents = 0;
+  const auto factors = math::factorize(n).value();
+  for (const auto &factor : factors) {
+    exponents += factor.exponent;
+  }
+  return exponents;
+}
+
+template <typename Fn>
+double us_per_key(const std::vector<std::uint64_t> &keys, Fn fn) {
+  return bench::best_time_ms([&] {
+           std::uint64_t sum = 0;
+           for (const auto k : keys) {
+             sum += fn(k);
+           }
+           bench::consume_checksum(sum);
+         }) *
+         1e3 / static_cast<double>(keys.size());
+}
+
+} // namespace
+
+int main() {
+  std::printf("# Benchmark: factorize (us/clave)\n\n");
+  bench::print_table_header(
+      {"claves", "división (us)", "math::factorize (us)", "speedup"});
+  const auto keys40 = make_keys(2000, 40);
+  const double t_trial = us_per_key(keys40, trial_division_exponents);
+  const double t_fast = us_per_key(keys40, factorize_exponents);
+  std::printf("| aleatorias de 40 bits | %.2f | %.2f | %.0fx |\n", t_trial,
+              t_fast, t_trial / t_fast);
+  std::printf("| aleatorias de 64 bits | - | %.2f | - |\n",
+              us_per_key(make_keys(20000, 64), factorize_exponents));
+  std::printf("| semiprimos 32 x 32 bits | - | %.2f | - |\n",
+              us_per_key(make_semiprimes(200), factorize_exponents));
+
+  std::printf("\n# Benchmark: factorize_batch (ms)\n\n");
+  bench::print_table_header({"claves", "1 hilo (ms)", "todos (ms)",
+                             "speedup"});
+  const auto keys = make_keys(1 << 16, 64);
+  std::vector<math::Factorization<std::uint64_t>> out(keys.size());
+  std::vector<core::MathError> status(keys.size());
+  math::ParallelConfig serial;
+  serial.thread_count = 1;
+  const double t_serial = bench::best_time_ms([&] {
+    bench::consume_checksum(math::factorize_batch(
+        keys.data(), keys.size(), out.data(), status.data(), serial));
+  });
+  const double t_parallel = bench::best_time_ms([&] {
+    bench::consume_checksum(math::factorize_batch(keys.data(), keys.size(),
+                                                  out.data(), status.data()));
+  });
+  std::printf("| %zu aleatorias de 64 bits | %.1f | %.1f | %.1fx |\n",
+              keys.size(), t_serial, t_parallel, t_serial / t_parallel);
+  return 0;
+}
@@ -0,0 +1,122 @@
+/* ==============================================================================
+ * Archivo: bench_gcd.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Mide el coste de gcd(a, b):
+ * - Tipos nativos: `std::gcd` (Euclides con `%` en libstdc++) frente a
+ *   `math::gcd` (Stein con `ctz`).
+ * - cpp_int: `boost::multiprecision::gcd` frente a `math::gcd` (Lehmer),
+ *   para operandos de distintos tamaños.
+ *
+ * Uso: bench_gcd
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/math/gcd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric> // Para std::gcd
+#include <vector>
+
+using namespace numbers_calculations;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+constexpr std::size_t PAIRS = 1 << 14;
+
+std::uint64_t next_random(std::uint64_t &state) {
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return state;
+}
+
+template <typename T> void run_native(const char *name) {
+  std::vector<T> a(PAIRS), b(PAIRS);
+  std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (std::size_t i = 0; i < PAIRS; ++i) {
+    a[i] = static_cast<T>(next_random(state));
+    b[i] = static_cast<T>(next_random(state));
+    if constexpr (sizeof(T) > 8) {
+      a[i] = (a[i] << 64) | next_random(state);
+      b[i] = (b[i] << 64) | next_random(state);
+    }
+  }
+  const double t_std = bench::best_time_ms([&] {
+    T sink = 0;
+    for (std::size_t i = 0; i < PAIRS; ++i) {
+      if constexpr (sizeof(T) > 8) {
+        // std::gcd no admite __int128 en modo estricto: Euclides a mano
+        T x = a[i], y = b[i];
+        while (y != 0) {
+          const T r = x % y;
+          x = y;
+          y = r;
+        }
+        sink ^= x;
+      } else {
+        sink ^= std::gcd(a[i], b[i]);
+      }
+    }
+    bench::consume_checksum(sink);
+  });
+  const double t_stein = bench::best_time_ms([&] {
+    T sink = 0;
+    for (std::size_t i = 0; i < PAIRS; ++i) {
+      sink ^= math::gcd(a[i], b[i]).value();
+    }
+    bench::consume_checksum(sink);
+  });
+  std::printf("| %s | %.1f | %.1f | %.1fx |\n", name, t_std * 1e6 / PAIRS,
+              t_stein * 1e6 / PAIRS, t_std / t_stein);
+}
+
+void run_big(int limbs) {
+  const std::size_t pairs = limbs <= 16 ? 512 : 16;
+  std::vector<mp::cpp_int> a(pairs), b(pairs);
+  std::uint64_t state = 0x2545F4914F6CDD1DULL;
+  for (std::size_t i = 0; i < pairs; ++i) {
+    for (int l = 0; l < limbs; ++l) {
+      a[i] = (a[i] << 64) | next_random(state);
+      b[i] = (b[i] << 64) | next_random(state);
+    }
+  }
+  const double t_boost = bench::best_time_ms([&] {
+    for (std::size_t i = 0; i < pairs; ++i) {
+      bench::do_not_optimize(mp::cpp_int(mp::gcd(a[i], b[i])));
+    }
+  });
+  const double t_lehmer = bench::best_time_ms([&] {
+    for (std::size_t i = 0; i < pairs; ++i) {
+      bench::do_not_optimize(math::gcd(a[i], b[i]).value());
+    }
+  });
+  std::printf("| cpp_int %d bits | %.1f | %.1f | %.1fx |\n", 64 * limbs,
+              t_boost * 1e3 / pairs, t_lehmer * 1e3 / pairs,
+              t_boost / t_lehmer);
+}
+
+} // namespace
+
+int main() {
+  std::printf("# Benchmark: gcd nativo (ns/llamada)\n\n");
+  bench::print_table_header(
+      {"tipo", "std::gcd (ns)", "math::gcd (ns)", "speedup"});
+  run_native<std::uint32_t>("uint32_t");
+  run_native<std::uint64_t>("uint64_t");
+#if HAS_NATIVE_INT128
+  run_native<core::uint128_t>("uint128_t");
+#endif
+
+  std::printf("\n# Benchmark: gcd de cpp_int (us/llamada)\n\n");
+  bench::print_table_header(
+      {"tipo", "boost::gcd (us)", "math::gcd (us)", "speedup"});
+  for (int limbs : {2, 8, 32, 128, 512}) {
+    run_big(limbs);
+  }
+  return 0;
+}
@@ -0,0 +1,130 @@
+/* ==============================================================================
+ * Archivo: bench_int128_io.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Mide la conversión decimal de enteros de 128 bits (`core/numeric_io.hpp`):
+ * - Formateo: el algoritmo original de `operator<<` (`% 10` y `/ 10` de 128
+ *   bits por cifra en un std::string, y `reverse`) frente a `to_chars`.
+ * - Lectura: el algoritmo original de `operator>>` (`checked_mul_add` de
+ *   128 bits por cifra) frente a `from_chars` (SWAR, o SSE4.1 si se
+ *   compila con -msse4.1).
+ *
+ * Uso: bench_int128_io
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/core/checked_arith.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/numeric_io.hpp>
+
+#include <algorithm> // Para std::reverse
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace numbers_calculations;
+using core::int128_t;
+using core::uint128_t;
+
+namespace {
+
+constexpr std::size_t VALUES = 1 << 16;
+
+std::uint64_t next_random(std::uint64_t &state) {
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return state;
+}
+
+// El formateador original, cifra a cifra.
+std::string legacy_format(uint128_t temp) {
+  std::string s;
+  s.reserve(40);
+  while (temp > 0) {
+    s += static_cast<char>((temp % 10) + '0');
+    temp /= 10;
+  }
+  std::reverse(s.begin(), s.end());
+  return s;
+}
+
+// El parser original, con comprobación de overflow por cifra.
+int128_t legacy_parse(const std::string &s) {
+  int128_t val = 0;
+  for (const char c : s) {
+    val = *core::checked_mul_add(val, int128_t{10}, int128_t{c - '0'});
+  }
+  return val;
+}
+
+void run(const char *name, int bits) {
+  std::vector<uint128_t> values(VALUES);
+  std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (auto &v : values) {
+    v = ((uint128_t{next_random(state)} << 64) | next_random(state)) >>
+        (128 - bits);
+    v |= 1; // el original no formatea el 0
+  }
+
+  const double t_legacy_fmt = bench::best_time_ms([&] {
+    std::uint64_t sum = 0;
+    for (const uint128_t v : values) {
+      sum += legacy_format(v).size();
+    }
+    bench::consume_checksum(sum);
+  });
+  std::vector<char> text(VALUES * 40);
+  std::vector<std::size_t> lengths(VALUES);
+  const double t_to_chars = bench::best_time_ms([&] {
+    char *out = text.data();
+    for (std::size_t i = 0; i < VALUES; ++i) {
+      const auto r = core::to_chars(out, out + 40, values[i]);
+      lengths[i] = static_cast<std::size_t>(r.ptr - out);
+      out += 40;
+    }
+    bench::consume_checksum(lengths[VALUES - 1]);
+  });
+
+  // Para la lectura: valores < 2^127 (el parser original es con signo)
+  std::vector<std::string> strings(VALUES);
+  for (std::size_t i = 0; i < VALUES; ++i) {
+    strings[i] = legacy_format(values[i] >> (bits == 128 ? 1 : 0));
+  }
+  const double t_legacy_parse = bench::best_time_ms([&] {
+    std::uint64_t sum = 0;
+    for (const auto &s : strings) {
+      sum += static_cast<std::uint64_t>(legacy_parse(s));
+    }
+    bench::consume_checksum(sum);
+  });
+  const double t_from_chars = bench::best_time_ms([&] {
+    std::uint64_t sum = 0;
+    for (const auto &s : strings) {
+      uint128_t v = 0;
+      core::from_chars(s.data(), s.data() + s.size(), v);
+      sum += static_cast<std::uint64_t>(v);
+    }
+    bench::consume_checksum(sum);
+  });
+
+  std::printf("| %s | %.1f | %.1f | %.1fx | %.1f | %.1f | %.1fx |\n", name,
+              t_legacy_fmt * 1e6 / VALUES, t_to_chars * 1e6 / VALUES,
+              t_legacy_fmt / t_to_chars, t_legacy_parse * 1e6 / VALUES,
+              t_from_chars * 1e6 / VALUES, t_legacy_parse / t_from_chars);
+}
+
+} // namespace
+
+int main() {
+  std::printf("# Benchmark: E/S decimal de 128 bits (ns/valor)\n\n");
+  bench::print_table_header({"valores", "original << (ns)", "to_chars (ns)",
+                             "speedup", "original >> (ns)",
+                             "from_chars (ns)", "speedup"});
+  run("< 2^64", 64);
+  run("< 2^96", 96);
+  run("< 2^128", 128);
+  return 0;
+}
@@ -0,0 +1,78 @@
+/* ==============================================================================
+ * Archivo: bench_integer_power.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Compara la exponenciación de tipos de Boost:
+ * - Binaria de derecha a izquierda (`internal::generic_power`).
+ * - Ventana deslizante de izquierda a derecha
+ *   (`internal::sliding_window_power`, la rama de `integer_power`).
+ * - `boost::multiprecision::pow` como referencia.
+ *
+ * Para los tipos de ancho fijo se eligen base y exponente de forma que el
+ * resultado llene el tipo sin desbordar.
+ *
+ * Uso: bench_integer_power
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/math/integer_ops.hpp>
+
+#include <cstdint>
+#include <cstdio>
+
+using namespace numbers_calculations;
+namespace mp = boost::multiprecision;
+
+using uint2048_t = mp::number<mp::cpp_int_backend<
+    2048, 2048, mp::unsigned_magnitude, mp::unchecked, void>>;
+
+namespace {
+
+template <typename T>
+void run(const char *name, const T &base, std::uint64_t exp, int calls) {
+  const double t_binary = bench::best_time_ms([&] {
+    for (int c = 0; c < calls; ++c) {
+      bench::do_not_optimize(math::internal::generic_power(base, exp));
+    }
+  });
+  const double t_window = bench::best_time_ms([&] {
+    for (int c = 0; c < calls; ++c) {
+      bench::do_not_optimize(math::internal::sliding_window_power(base, exp));
+    }
+  });
+  const double t_boost = bench::best_time_ms([&] {
+    for (int c = 0; c < calls; ++c) {
+      bench::do_not_optimize(T{mp::pow(base, static_cast<unsigned>(exp))});
+    }
+  });
+  std::printf("| %s | %llu | %.3f | %.3f | %.3f | %.2fx |\n", name,
+              static_cast<unsigned long long>(exp), t_binary * 1e3 / calls,
+              t_window * 1e3 / calls, t_boost * 1e3 / calls,
+              t_binary / t_window);
+}
+
+} // namespace
+
+int main() {
+  std::printf("# Benchmark: integer_power para tipos de Boost (us/llamada)\n\n");
+  bench::print_table_header({"tipo", "exponente", "binaria", "ventana",
+                             "boost::pow", "speedup vs binaria"});
+
+  // Base de 61 bits (impar): el resultado ocupa ~61 * exp bits
+  const std::uint64_t b61 = (std::uint64_t{1} << 60) + 12345;
+  run<mp::uint1024_t>("uint1024_t", mp::uint1024_t(3), 640, 2000);
+  run<mp::uint1024_t>("uint1024_t", mp::uint1024_t(b61), 16, 20000);
+  run<uint2048_t>("uint2048_t", uint2048_t(3), 1290, 1000);
+  run<uint2048_t>("uint2048_t", uint2048_t(b61), 33, 10000);
+  for (const std::uint64_t exp : {100u, 1000u, 10000u, 100000u}) {
+    const int calls = exp >= 100000 ? 3 : exp >= 10000 ? 20 : 500;
+    run<mp::cpp_int>("cpp_int", mp::cpp_int(b61), exp, calls);
+  }
+  for (const std::uint64_t exp : {1000u, 100000u, 1000000u}) {
+    const int calls = exp >= 1000000 ? 2 : exp >= 100000 ? 10 : 1000;
+    run<mp::cpp_int>("cpp_int (base 3)", mp::cpp_int(3), exp, calls);
+  }
+  return 0;
+}
@@ -0,0 +1,178 @@
+/* ==============================================================================
+ * Archivo: bench_is_prime.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Mide el coste de `math::is_prime`:
+ * - 64 bits: Miller-Rabin con las mismas bases reduciendo con `%` en
+ *   128 bits (`internal::mod_pow`) frente a Montgomery + división rápida.
+ * - 128 bits: `miller_rabin_test` de Boost sobre cpp_int (una sola ronda)
+ *   frente a BPSW.
+ * - `is_prime_batch` con 1 hilo y con todos.
+ *
+ * Se mide con primos (el peor caso: hacen todas las bases) y con impares
+ * aleatorios (el caso típico: casi todos salen en la división).
+ *
+ * Uso: bench_is_prime
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/math/internal/modular_factorial_table.hpp>
+#include <numbers_calculations/math/primality.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace numbers_calculations;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+constexpr std::size_t CALLS = 4096;
+
+std::uint64_t next_random(std::uint64_t &state) {
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return state;
+}
+
+// Miller-Rabin de referencia: mismas bases, reducción con `%`.
+bool division_miller_rabin(std::uint64_t n) {
+  if (n < 2 || n % 2 == 0) {
+    return n == 2;
+  }
+  for (std::uint64_t p = 3; p < 256; p += 2) {
+    if (n % p == 0) {
+      return n == p;
+    }
+  }
+  std::uint64_t d = n - 1;
+  unsigned s = 0;
+  while (d % 2 == 0) {
+    d /= 2;
+    ++s;
+  }
+  for (const std::uint64_t base : math::internal::MILLER_RABIN_64_BASES) {
+    std::uint64_t x = math::internal::mod_pow(base % n, d, n);
+    if (base % n == 0 || x == 1 || x == n - 1) {
+      continue;
+    }
+    bool witness = true;
+    for (unsigned r = 1; r < s && witness; ++r) {
+      x = math::internal::mod_mul(x, x, n);
+      witness = x != n - 1;
+    }
+    if (witness) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T> std::vector<T> make_inputs(int bits, bool primes_only) {
+  std::vector<T> values;
+  values.reserve(CALLS);
+  std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  while (values.size() < CALLS) {
+    T n = static_cast<T>(next_random(state));
+    if constexpr (sizeof(T) > 8) {
+      n = (n << 64) | next_random(state);
+    }
+    n = (n >> (8 * sizeof(T) - static_cast<unsigned>(bits))) | 1;
+    if (!primes_only || math::is_prime(n)) {
+      values.push_back(n);
+    }
+  }
+  return values;
+}
+
+template <typename Fn> double ns_per_call(Fn fn) {
+  return bench::best_time_ms(fn) * 1e6 / CALLS;
+}
+
+void run_64(const char *name, bool primes_only) {
+  const auto values = make_inputs<std::uint64_t>(64, primes_only);
+  const double t_div = ns_per_call([&] {
+    std::uint64_t count = 0;
+    for (const auto n : values) {
+      count += division_miller_rabin(n);
+    }
+    bench::consume_checksum(count);
+  });
+  const double t_fast = ns_per_call([&] {
+    std::uint64_t count = 0;
+    for (const auto n : values) {
+      count += math::is_prime(n);
+    }
+    bench::consume_checksum(count);
+  });
+  std::printf("| uint64_t %s | %.0f | %.0f | %.1fx |\n", name, t_div, t_fast,
+              t_div / t_fast);
+}
+
+void run_128(const char *name, bool primes_only) {
+  const auto values = make_inputs<core::uint128_t>(128, primes_only);
+  const double t_boost = ns_per_call([&] {
+    std::uint64_t count = 0;
+    for (const auto n : values) {
+      count += mp::miller_rabin_test(mp::cpp_int(n), 1);
+    }
+    bench::consume_checksum(count);
+  });
+  const double t_fast = ns_per_call([&] {
+    std::uint64_t count = 0;
+    for (const auto n : values) {
+      count += math::is_prime(n);
+    }
+    bench::consume_checksum(count);
+  });
+  std::printf("| uint128_t %s | %.0f | %.0f | %.1fx |\n", name, t_boost,
+              t_fast, t_boost / t_fast);
+}
+
+void run_batch() {
+  std::vector<std::uint64_t> values(1 << 20);
+  std::uint64_t state = 0x2545F4914F6CDD1DULL;
+  for (auto &v : values) {
+    v = next_random(state) | 1;
+  }
+  std::vector<char> out_storage(values.size());
+  bool *out = reinterpret_cast<bool *>(out_storage.data());
+
+  math::ParallelConfig serial;
+  serial.thread_count = 1;
+  const double t_serial = bench::best_time_ms(
+      [&] {
+        bench::consume_checksum(
+            math::is_prime_batch(values.data(), values.size(), out, serial));
+      });
+  const double t_parallel = bench::best_time_ms(
+      [&] {
+        bench::consume_checksum(
+            math::is_prime_batch(values.data(), values.size(), out));
+      });
+  std::printf("| %zu impares de 64 bits | %.1f | %.1f | %.1fx |\n",
+              values.size(), t_serial, t_parallel, t_serial / t_parallel);
+}
+
+} // namespace
+
+int main() {
+  std::printf("# Benchmark: is_prime (ns/llamada)\n\n");
+  bench::print_table_header({"entrada", "referencia (ns)",
+                             "math::is_prime (ns)", "speedup"});
+  run_64("primos", true);
+  run_64("impares", false);
+  run_128("primos", true);
+  run_128("impares", false);
+
+  std::printf("\n# Benchmark: is_prime_batch (ms)\n\n");
+  bench::print_table_header({"entrada", "1 hilo (ms)", "todos (ms)",
+                             "speedup"});
+  run_batch();
+  return 0;
+}
@@ -0,0 +1,133 @@
+/* ==============================================================================
+ * Archivo: bench_power_mod.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Mide el coste de (base ^ exp) mod m con exponentes del mismo tamaño que
+ * el módulo (el caso de los tests de primalidad):
+ * - `powm` de Boost sobre cpp_int (la alternativa sin `power_mod`).
+ * - Exponenciación binaria reduciendo con `%` en el tipo de doble ancho
+ *   (sólo 64 bits; es `internal::mod_pow`).
+ * - `math::power_mod` con Montgomery y con Barrett.
+ *
+ * Uso: bench_power_mod
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/math/internal/modular_factorial_table.hpp>
+#include <numbers_calculations/math/modular_arith.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace numbers_calculations;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+constexpr std::size_t CALLS = 2000;
+
+struct Case {
+  core::uint128_t base;
+  core::uint128_t exp;
+};
+
+std::vector<Case> make_cases(int bits) {
+  std::vector<Case> cases(CALLS);
+  std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  const auto next = [&state] {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return state;
+  };
+  for (Case &c : cases) {
+    c.base = (core::uint128_t{next()} << 64) | next();
+    c.exp = (core::uint128_t{next()} << 64) | next();
+    if (bits < 128) {
+      c.base >>= 128 - bits;
+      c.exp >>= 128 - bits;
+    }
+  }
+  return cases;
+}
+
+template <typename Fn> double ns_per_call(Fn fn) {
+  return bench::best_time_ms(fn) * 1e6 / CALLS;
+}
+
+void run_64(const char *name, std::uint64_t m) {
+  const auto cases = make_cases(64);
+  const double t_powm = ns_per_call([&] {
+    for (const Case &c : cases) {
+      bench::do_not_optimize(mp::cpp_int(mp::powm(
+          mp::cpp_int(c.base), mp::cpp_int(c.exp), mp::cpp_int(m))));
+    }
+  });
+  const double t_div = ns_per_call([&] {
+    std::uint64_t sink = 0;
+    for (const Case &c : cases) {
+      sink ^= math::internal::mod_pow(static_cast<std::uint64_t>(c.base),
+                                      static_cast<std::uint64_t>(c.exp), m);
+    }
+    bench::consume_checksum(sink);
+  });
+  const double t_mont = ns_per_call([&] {
+    std::uint64_t sink = 0;
+    for (const Case &c : cases) {
+      sink ^= math::power_mod(static_cast<std::uint64_t>(c.base),
+                              static_cast<std::uint64_t>(c.exp), m,
+                              math::ModularMethod::Montgomery)
+                  .value();
+    }
+    bench::consume_checksum(sink);
+  });
+  const double t_barrett = ns_per_call([&] {
+    std::uint64_t sink = 0;
+    for (const Case &c : cases) {
+      sink ^= math::power_mod(static_cast<std::uint64_t>(c.base),
+                              static_cast<std::uint64_t>(c.exp), m,
+                              math::ModularMethod::Barrett)
+                  .value();
+    }
+    bench::consume_checksum(sink);
+  });
+  std::printf("| %s | %.0f | %.0f | %.0f | %.0f |\n", name, t_powm, t_div,
+              t_mont, t_barrett);
+}
+
+void run_128(const char *name, core::uint128_t m) {
+  const auto cases = make_cases(128);
+  const double t_powm = ns_per_call([&] {
+    for (const Case &c : cases) {
+      bench::do_not_optimize(mp::cpp_int(mp::powm(
+          mp::cpp_int(c.base), mp::cpp_int(c.exp), mp::cpp_int(m))));
+    }
+  });
+  const double t_power_mod = ns_per_call([&] {
+    core::uint128_t sink = 0;
+    for (const Case &c : cases) {
+      sink ^= math::power_mod(c.base, c.exp, m).value();
+    }
+    bench::consume_checksum(sink);
+  });
+  std::printf("| %s | %.0f | - | %.0f | - |\n", name, t_powm, t_power_mod);
+}
+
+} // namespace
+
+int main() {
+  std::printf("# Benchmark: exponenciación modular (ns/llamada)\n\n");
+  bench::print_table_header(
+      {"módulo", "powm cpp_int", "% (doble ancho)", "power_mod Montgomery",
+       "power_mod Barrett"});
+  run_64("2^61 - 1 (impar)", (std::uint64_t{1} << 61) - 1);
+  run_64("2^64 - 59 (impar)", 18446744073709551557ULL);
+  run_64("10^18 (par)", 1000000000000000000ULL);
+  run_128("2^127 - 1 (impar)", (core::uint128_t{1} << 127) - 1);
+  run_128("2^128 - 159 (impar)", ~core::uint128_t{0} - 158);
+  run_128("2^100 * 3 (par)", core::uint128_t{3} << 100);
+  return 0;
+}
@@ -0,0 +1,78 @@
+/* ==============================================================================
+ * Archivo: bench_prime_sieve.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Mide el rendimiento de la criba segmentada (`math/primes.hpp`):
+ * - pi(n) con la criba clásica de un único array de n / 2 bits
+ *   (`internal::simple_sieve_primes`) frente a `prime_count` con 1 hilo
+ *   y con todos.
+ * - Recorrido de `primes_in(lo, hi)` en un tramo alto (10^12), donde la
+ *   criba clásica necesitaría un array de 62 GB.
+ *
+ * Uso: bench_prime_sieve
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/math/internal/prime_sieve.hpp>
+#include <numbers_calculations/math/primes.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+using namespace numbers_calculations;
+
+namespace {
+
+void run_count(std::uint64_t n) {
+  const double t_simple = bench::best_time_ms(
+      [&] {
+        bench::consume_checksum(
+            math::internal::simple_sieve_primes(static_cast<std::uint32_t>(n))
+                .size());
+      },
+      1);
+  math::ParallelConfig serial;
+  serial.thread_count = 1;
+  const double t_serial = bench::best_time_ms(
+      [&] { bench::consume_checksum(math::prime_count(n, serial).value()); },
+      1);
+  const double t_parallel = bench::best_time_ms(
+      [&] { bench::consume_checksum(math::prime_count(n).value()); }, 1);
+  std::printf("| %.0e | %.1f | %.1f | %.1f | %.1fx |\n",
+              static_cast<double>(n), t_simple, t_serial, t_parallel,
+              t_simple / t_parallel);
+}
+
+} // namespace
+
+int main() {
+  std::printf("# Benchmark: pi(n) (ms)\n\n");
+  bench::print_table_header({"n", "criba clásica (ms)",
+                             "prime_count 1 hilo (ms)",
+                             "prime_count todos (ms)", "speedup"});
+  for (const std::uint64_t n : {10000000ULL, 100000000ULL, 1000000000ULL}) {
+    run_count(n);
+  }
+
+  std::printf("\n# Benchmark: primes_in(10^12, 10^12 + 10^8)\n\n");
+  bench::print_table_header({"primos", "tiempo (ms)", "Mnúmeros/s"});
+  constexpr std::uint64_t lo = 1000000000000ULL;
+  constexpr std::uint64_t width = 100000000ULL;
+  std::uint64_t count = 0;
+  const double t_stream = bench::best_time_ms(
+      [&] {
+        count = 0;
+        auto range = math::primes_in(lo, lo + width).value();
+        for (const std::uint64_t p : range) {
+          count += p & 1;
+        }
+        bench::consume_checksum(count);
+      },
+      1);
+  std::printf("| %llu | %.1f | %.0f |\n", static_cast<unsigned long long>(count),
+              t_stream, static_cast<double>(width) / t_stream / 1e3);
+  return 0;
+}
@@ -0,0 +1,69 @@
+/* ==============================================================================
+ * Archivo: bench_radix_conversion.cpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Mide la conversión decimal de `cpp_int` (`core/multiprecision_io.hpp`)
+ * para números de 10^3 a 10^6 cifras:
+ * - Formateo: `cpp_int::str()` frente a `to_string` (divide y vencerás).
+ * - Lectura: constructor `cpp_int(std::string)` frente a `from_string`.
+ *
+ * Las potencias de 10 cacheadas por hilo se calculan en la primera
+ * repetición; el mejor tiempo corresponde a la caché ya llena.
+ *
+ * Uso: bench_radix_conversion
+ * ==============================================================================
+ */
+
+#include "bench_utils.hpp"
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/multiprecision_io.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+using namespace numbers_calculations;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+void run(unsigned exponent) {
+  // 3^e tiene e * log10(3) ~ 0.477 e cifras, sin ceros regulares
+  const mp::cpp_int value = mp::pow(mp::cpp_int(3), exponent);
+  const std::string text = value.str();
+  const int runs = text.size() > 200000 ? 2 : 5;
+
+  const double t_str = bench::best_time_ms(
+      [&] { bench::consume_checksum(value.str().size()); }, runs);
+  const double t_format = bench::best_time_ms(
+      [&] { bench::consume_checksum(core::to_string(value).size()); }, runs);
+  const double t_ctor = bench::best_time_ms(
+      [&] {
+        bench::consume_checksum(
+            static_cast<std::uint64_t>(mp::cpp_int(text) & 1));
+      },
+      runs);
+  const double t_parse = bench::best_time_ms(
+      [&] {
+        bench::consume_checksum(static_cast<std::uint64_t>(
+            *core::from_string<mp::cpp_int>(text) & 1));
+      },
+      runs);
+  std::printf("| %zu | %.3f | %.3f | %.1fx | %.3f | %.3f | %.1fx |\n",
+              text.size(), t_str, t_format, t_str / t_format, t_ctor, t_parse,
+              t_ctor / t_parse);
+}
+
+} // namespace
+
+int main() {
+  std::printf("# Benchmark: conversión decimal de cpp_int (ms)\n\n");
+  bench::print_table_header({"cifras", "str()", "to_string", "speedup",
+                             "cpp_int(string)", "from_string", "speedup"});
+  for (const unsigned exponent : {2096u, 20959u, 209590u, 2095904u}) {
+    run(exponent);
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: bench_utils.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Utilidades comunes para los benchmarks: cronómetro y salida en markdown.
+ * ==============================================================================
+ */
+
+#include <algorithm> // Para std::min
+#include <chrono>
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t
+#include <cstdio>  // Para std::printf
+#include <initializer_list>
+#include <utility> // Para std::forward
+
+namespace numbers_calculations::bench {
+
+/**
+ * @brief Ejecuta `fn` `repetitions` veces y devuelve el mejor tiempo (ms).
+ *
+ * Usar el mínimo en lugar de la media filtra el ruido del sistema operativo.
+ */
+template <typename Fn>
+double best_time_ms(Fn &&fn, int repetitions = 3) {
+  double best = 1e300;
+  for (int r = 0; r < repetitions; ++r) {
+    const auto t0 = std::chrono::steady_clock::now();
+    std::forward<Fn>(fn)();
+    const auto t1 = std::chrono::steady_clock::now();
+    best = std::min(
+        best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+  }
+  return best;
+}
+
+/**
+ * @brief Evita que el optimizador elimine un cálculo cuyo resultado no se usa.
+ */
+inline const void *volatile g_sink = nullptr;
+template <typename T> void do_not_optimize(const T &value) { g_sink = &value; }
+
+/**
+ * @brief Consume un resumen escalar (suma, XOR, recuento...) de un cálculo.
+ *
+ * `do_not_optimize` sólo publica la dirección; esto escribe el valor, así
+ * que el compilador tiene que calcularlo.
+ */
+inline volatile std::uint64_t g_checksum = 0;
+template <typename T> void consume_checksum(const T &value) {
+  g_checksum = static_cast<std::uint64_t>(value);
+}
+
+// Cabecera de tabla markdown: | col1 | col2 | ... |
+inline void print_table_header(std::initializer_list<const char *> columns) {
+  std::printf("|");
+  for (const char *c : columns) {
+    std::printf(" %s |", c);
+  }
+  std::printf("\n|");
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    std::printf("---|");
+  }
+  std::printf("\n");
+}
+
+} // namespace numbers_calculations::bench
@@ -0,0 +1,259 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: checked_arith.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Capa común de aritmética con comprobación de overflow (suma, producto y
+ * producto-suma) para todos los tipos de `is_supported_integer_v`.
+ *
+ * Explicación didáctica:
+ * La forma "de libro" de detectar que a * b desborda es preguntar antes
+ * `a > max / b`. Es correcta, pero cuesta una división por paso: ~25-40
+ * ciclos para 64 bits y una llamada a `__udivti3` (~50-100 ciclos) para
+ * uint128_t, frente a 1-3 ciclos de la propia multiplicación.
+ *
+ * Aquí se hace al revés: se multiplica y se pregunta al hardware.
+ * - GCC / Clang: `__builtin_mul_overflow` / `__builtin_add_overflow` se
+ *   compilan a la instrucción y al flag de overflow (`mul` + `jo`/`seto`),
+ *   también para __int128 y para tipos con signo.
+ * - Otros compiladores: multiplicación en un tipo del doble de ancho cuando
+ *   existe (ej. 32 -> 64 bits) y la división clásica sólo si no.
+ * - Tipos de Boost acotados (int1024_t...): el número de bits del resultado
+ *   está acotado por los de los operandos,
+ *
+ *       bits(a) + bits(b) - 1  <=  bits(a * b)  <=  bits(a) + bits(b)
+ *
+ *   así que `msb` decide casi siempre sin dividir; la división exacta queda
+ *   para la frontera (bits(a) + bits(b) == digits + 1).
+ * - Tipos de Boost de ancho arbitrario (cpp_int, mpz_int): nunca desbordan.
+ * ==============================================================================
+ */
+
+#include <limits>      // Para numeric_limits
+#include <type_traits> // Para std::conditional_t
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_supported_integer_v
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+
+// --- Detección de intrínsecos de overflow ---
+#if defined(__GNUC__) || defined(__clang__)
+#define HAS_INTRINSIC_BUILTIN_OVERFLOW
+#endif
+
+namespace numbers_calculations::core {
+
+namespace internal {
+
+/**
+ * @brief |x| para tipos de Boost (sólo niega si el tipo tiene signo).
+ */
+template <typename T> T boost_abs(const T &x) noexcept {
+  if constexpr (std::numeric_limits<T>::is_signed) {
+    if (x < 0) {
+      return T{-x};
+    }
+  }
+  return x;
+}
+
+/**
+ * @brief Número de bits de |x| (x != 0) para tipos de Boost.
+ *
+ * `msb` sólo admite valores positivos, así que los negativos se pasan a su
+ * magnitud (los enteros de Boost con signo son signo-magnitud: min == -max).
+ */
+template <typename T> unsigned boost_bit_length(const T &x) noexcept {
+  return static_cast<unsigned>(boost::multiprecision::msb(boost_abs(x))) + 1;
+}
+
+/**
+ * @brief Comprobación de a * b por división (con signo o sin él).
+ * Sólo para compiladores sin intrínsecos ni tipo más ancho.
+ */
+template <typename T>
+constexpr bool division_mul_overflow(const T &a, const T &b) noexcept {
+  constexpr T max = std::numeric_limits<T>::max();
+  constexpr T min = std::numeric_limits<T>::min();
+  if (a > 0) {
+    return b > 0 ? a > max / b : b < min / a;
+  }
+  if (a < 0) {
+    return b > 0 ? a < min / b : (b != 0 && b < max / a);
+  }
+  return false;
+}
+
+} // namespace internal
+
+// ==========================================================================
+// API PÚBLICA: primitivas con flag (sin saltos)
+// ==========================================================================
+
+/**
+ * @brief out = a * b. Devuelve true si el producto no cabe en T.
+ *
+ * Pensada para bucles calientes: el flag se puede acumular
+ * (`overflow |= mul_overflow(...)`) y consultar una sola vez al final.
+ * Si hay overflow, el valor de `out` no está especificado. `out` puede ser
+ * el mismo objeto que `a` o `b`.
+ *
+ * @test_property mul_overflow(2^32, 2^32, out) (uint64_t) == true
+ * @test_property mul_overflow(-2^31, 1, out) (int32_t) == false
+ */
+template <typename T,
+          std::enable_if_t<is_supported_integer_v<T>, int> = 0>
+constexpr bool mul_overflow(const T &a, const T &b, T &out) noexcept {
+  if constexpr (is_boost_integer_v<T>) {
+    if constexpr (std::numeric_limits<T>::is_bounded) {
+      if (a != 0 && b != 0) {
+        constexpr auto digits =
+            static_cast<unsigned>(std::numeric_limits<T>::digits);
+        const unsigned bits =
+            internal::boost_bit_length(a) + internal::boost_bit_length(b);
+        if (bits > digits + 1) {
+          return true;
+        }
+        // Frontera: el producto tiene digits o digits + 1 bits
+        if (bits == digits + 1) {
+          if (internal::boost_abs(a) >
+              std::numeric_limits<T>::max() / internal::boost_abs(b)) {
+            return true;
+          }
+        }
+      }
+    }
+    // Directamente sobre `out`, sin temporario intermedio
+    boost::multiprecision::multiply(out, a, b);
+    return false;
+  } else {
+#if defined(HAS_INTRINSIC_BUILTIN_OVERFLOW)
+    // Copias locales: si `out` es `a` o `b`, GCC puede releer el operando
+    // ya sobrescrito al calcular el flag
+    const T lhs = a;
+    const T rhs = b;
+    return __builtin_mul_overflow(lhs, rhs, &out);
+#else
+    if constexpr (sizeof(T) <= 4) {
+      // Producto exacto en 64 bits
+      using Wide =
+          std::conditional_t<std::numeric_limits<T>::is_signed, long long,
+                             unsigned long long>;
+      const Wide product = static_cast<Wide>(a) * static_cast<Wide>(b);
+      out = static_cast<T>(product);
+      return product > static_cast<Wide>(std::numeric_limits<T>::max()) ||
+             product < static_cast<Wide>(std::numeric_limits<T>::min());
+    } else {
+      if (internal::division_mul_overflow(a, b)) {
+        return true;
+      }
+      out = a * b;
+      return false;
+    }
+#endif
+  }
+}
+
+/**
+ * @brief out = a + b. Devuelve true si la suma no cabe en T.
+ *
+ * Mismas reglas que `mul_overflow`.
+ *
+ * @test_property add_overflow(max, 1, out) == true
+ * @test_property add_overflow(min, -1, out) (con signo) == true
+ */
+template <typename T,
+          std::enable_if_t<is_supported_integer_v<T>, int> = 0>
+constexpr bool add_overflow(const T &a, const T &b, T &out) noexcept {
+  if constexpr (is_boost_integer_v<T>) {
+    if constexpr (std::numeric_limits<T>::is_bounded) {
+      // Sólo pueden desbordar dos sumandos del mismo signo
+      if (b > 0 && a > std::numeric_limits<T>::max() - b) {
+        return true;
+      }
+      if constexpr (std::numeric_limits<T>::is_signed) {
+        if (b < 0 && a < std::numeric_limits<T>::min() - b) {
+          return true;
+        }
+      }
+    }
+    out = a + b;
+    return false;
+  } else {
+#if defined(HAS_INTRINSIC_BUILTIN_OVERFLOW)
+    const T lhs = a;
+    const T rhs = b;
+    return __builtin_add_overflow(lhs, rhs, &out);
+#else
+    if ((b > 0 && a > std::numeric_limits<T>::max() - b) ||
+        (b < 0 && a < std::numeric_limits<T>::min() - b)) {
+      return true;
+    }
+    out = static_cast<T>(a + b);
+    return false;
+#endif
+  }
+}
+
+// ==========================================================================
+// API PÚBLICA: versiones con core::Expected
+// ==========================================================================
+
+/**
+ * @brief Calcula a * b comprobando overflow.
+ *
+ * @tparam T Cualquier tipo de `is_supported_integer_v` (con o sin signo).
+ * @return El producto o `MathError::Overflow` si no cabe en T.
+ *
+ * @test_property checked_mul(3, 4) == 12
+ * @test_property checked_mul(uint128_max, 2) == MathError::Overflow
+ * @test_property checked_mul(cpp_int a, cpp_int b) == a * b (nunca desborda)
+ */
+template <typename T,
+          std::enable_if_t<is_supported_integer_v<T>, int> = 0>
+constexpr Expected<T> checked_mul(const T &a, const T &b) noexcept {
+  T out{};
+  if (mul_overflow(a, b, out)) {
+    return Unexpected(MathError::Overflow);
+  }
+  return out;
+}
+
+/**
+ * @brief Calcula a + b comprobando overflow.
+ *
+ * @test_property checked_add(max - 1, 1) == max
+ * @test_property checked_add(max, 1) == MathError::Overflow
+ */
+template <typename T,
+          std::enable_if_t<is_supported_integer_v<T>, int> = 0>
+constexpr Expected<T> checked_add(const T &a, const T &b) noexcept {
+  T out{};
+  if (add_overflow(a, b, out)) {
+    return Unexpected(MathError::Overflow);
+  }
+  return out;
+}
+
+/**
+ * @brief Calcula a * b + c comprobando overflow en ambos pasos.
+ *
+ * Es el paso de las recurrencias del tipo `acc = acc * base + digit`
+ * (parsers, triángulos de Stirling, Horner...).
+ *
+ * @test_property checked_mul_add(12, 10, 3) == 123
+ * @test_property checked_mul_add(UINT64_MAX / 10, 10, 6) == MathError::Overflow
+ */
+template <typename T,
+          std::enable_if_t<is_supported_integer_v<T>, int> = 0>
+constexpr Expected<T> checked_mul_add(const T &a, const T &b,
+                                      const T &c) noexcept {
+  T out{};
+  const bool overflow = mul_overflow(a, b, out);
+  if (overflow || add_overflow(out, c, out)) {
+    return Unexpected(MathError::Overflow);
+  }
+  return out;
+}
+
+} // namespace numbers_calculations::core
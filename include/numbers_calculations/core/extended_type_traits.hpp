@@ -32,6 +32,16 @@
 #define HAS_NATIVE_INT128 0
 #endif
 
+// --- Detección de std::span (C++20) ---
+// Las sobrecargas con std::span de las operaciones por lotes dependen de
+// esta macro.
+#if __cplusplus >= 202002L
+#include <span>
+#define HAS_CPP20_SPAN 1
+#else
+#define HAS_CPP20_SPAN 0
+#endif
+
 // --- Inclusión de Boost.Multiprecision ---
 // Se asume que Boost está disponible (vía vcpkg para MSVC o sistema para
 // GCC/Clang) Si no se encuentra, los traits para Boost simplemente evaluarán a
@@ -179,5 +189,46 @@ struct is_supported_integer
 template <typename T>
 inline constexpr bool is_supported_integer_v = is_supported_integer<T>::value;
 
+// 6. is_signed / is_unsigned (extendidos)
+// std::is_signed_v<__int128> es false en modo estricto (-std=c++XX sin
+// extensiones GNU), así que nos basamos en std::numeric_limits, que sí está
+// especializado para __int128 y para todos los tipos de Boost.
+template <typename T>
+inline constexpr bool is_signed_v =
+    is_supported_integer_v<T> && std::numeric_limits<T>::is_signed;
+template <typename T>
+inline constexpr bool is_unsigned_v =
+    is_supported_integer_v<T> && !std::numeric_limits<T>::is_signed;
+
+// 7. wider_unsigned
+// Tipo sin signo con el doble de bits que T, para productos intermedios que
+// no pueden desbordar (ej. a * b con a, b < 2^64 siempre cabe en 128 bits).
+// Vale `void` si no hay un tipo más ancho disponible.
+template <typename T, typename = void> struct wider_unsigned {
+  using type = void;
+};
+template <typename T>
+struct wider_unsigned<
+    T, std::enable_if_t<std::is_integral_v<T> && (sizeof(T) <= 4)>> {
+  using type = unsigned long long;
+};
+#if HAS_NATIVE_INT128
+template <typename T>
+struct wider_unsigned<
+    T, std::enable_if_t<std::is_integral_v<T> && (sizeof(T) == 8)>> {
+  using type = uint128_t;
+};
+#endif
+#if HAS_NATIVE_INT128 && HAS_BOOST_MULTIPRECISION
+template <typename T>
+struct wider_unsigned<T, std::enable_if_t<is_native_int128_v<T>>> {
+  using type = boost::multiprecision::uint256_t;
+};
+#endif
+template <typename T>
+using wider_unsigned_t = typename wider_unsigned<T>::type;
+
 // Los numeric_limits para Boost ya están proporcionados por la propia
 // biblioteca Boost. No necesitamos especializarlos manualmente.
+
+} // namespace numbers_calculations::core
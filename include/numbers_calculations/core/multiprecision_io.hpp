@@ -0,0 +1,571 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: multiprecision_io.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Conversión decimal de los tipos de Boost.Multiprecision en tiempo
+ * subcuadrático, y `to_string` / `from_string` para todos los tipos de
+ * `is_supported_integer_v` (como pide "gemini.md"):
+ * - `to_chars` / `from_chars` para tipos de Boost (semántica de
+ *   `<charconv>`, base 10), escribiendo en un buffer del llamador.
+ * - `to_string(x)`: reserva una sola vez y llama a `to_chars`.
+ * - `from_string<T>(texto)`: `core::Expected<T>` con el valor.
+ *
+ * Explicación didáctica:
+ * `cpp_int::str()` saca las cifras dividiendo una y otra vez por una
+ * potencia de 10 de una palabra: O(n) divisiones de un número de n cifras,
+ * O(n^2). Con un millón de cifras eso son ~9 s.
+ *
+ * Divide y vencerás: con P = 10^(L * 2^k) (L = RADIX_LEAF_DIGITS),
+ *
+ *     x = q * P + r,  0 <= r < P   ->   cifras(x) = cifras(q) ++ cifras(r)
+ *
+ * donde r se escribe con exactamente L * 2^k cifras (con ceros a la
+ * izquierda) y q y r se parten igual con 10^(L * 2^(k-1)), hasta llegar a
+ * hojas de L cifras, que se convierten con el método clásico. Leer es el
+ * camino inverso: x = alta * P + baja.
+ *
+ * Que el total sea subcuadrático exige que cada nivel cueste como una
+ * multiplicación (Karatsuba en `cpp_int`, O(n^1.58)). Multiplicar ya lo
+ * es; la división de Boost es la escolar, O(n^2), así que aquí se divide
+ * con Barrett: q = (x * inv) >> 2b con inv = floor(2^(2b) / P), y el
+ * inverso se calcula con Newton (sólo multiplicaciones).
+ *
+ * Las potencias 10^(L * 2^k) y sus inversos se guardan en una caché
+ * `thread_local` por nivel (como `math/internal/log_power_cache.hpp`): la
+ * primera conversión de un tamaño los calcula y las siguientes del mismo
+ * hilo los reutilizan.
+ * ==============================================================================
+ */
+
+#include <charconv> // Para std::to_chars_result y std::from_chars_result
+#include <cstddef>  // Para std::size_t
+#include <cstdint>  // Para std::uint32_t y std::uint64_t
+#include <cstring>  // Para std::memcpy y std::memmove
+#include <deque>    // Para la caché de niveles (referencias estables)
+#include <iterator> // Para std::back_inserter
+#include <limits>   // Para std::numeric_limits
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_boost_integer_v
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/core/numeric_io.hpp> // Para to_chars de 128 bits y skip_digits
+#include <string>
+#include <string_view>
+#include <system_error> // Para std::errc
+#include <type_traits>  // Para std::is_same_v
+#include <utility>      // Para std::move
+#include <vector>
+
+namespace numbers_calculations::core {
+
+#if HAS_BOOST_MULTIPRECISION
+
+namespace internal {
+
+using BigInt = boost::multiprecision::cpp_int;
+
+/**
+ * @brief true para `number<cpp_int_backend<...>>` (cpp_int y los de ancho
+ * fijo): son los que usan la conversión por divide y vencerás. GMP y
+ * libtommath ya traen la suya.
+ */
+template <typename T> struct is_cpp_int_number : std::false_type {};
+template <unsigned MinBits, unsigned MaxBits,
+          boost::multiprecision::cpp_integer_type SignType,
+          boost::multiprecision::cpp_int_check_type Checked, class Allocator,
+          boost::multiprecision::expression_template_option ET>
+struct is_cpp_int_number<
+    boost::multiprecision::number<boost::multiprecision::cpp_int_backend<
+                                      MinBits, MaxBits, SignType, Checked,
+                                      Allocator>,
+                                  ET>> : std::true_type {};
+
+// Las hojas trabajan en "limbs" de 32 bits con 9 cifras por paso.
+inline constexpr std::uint32_t RADIX_LIMB_BASE = 1000000000; // 10^9
+inline constexpr std::size_t RADIX_LIMB_DIGITS = 9;
+
+// Cifras por hoja (64 bloques de 9, ~1900 bits): por debajo, el método
+// clásico gana a las divisiones de Barrett.
+inline constexpr std::size_t RADIX_LEAF_DIGITS = 64 * RADIX_LIMB_DIGITS;
+
+// Por debajo de estos bits el inverso se calcula con la división de Boost.
+inline constexpr std::size_t RADIX_DIRECT_INVERSE_BITS = 4096;
+
+// Bits de más en la mitad alta de cada paso de Newton.
+inline constexpr std::size_t RADIX_NEWTON_GUARD_BITS = 32;
+
+/**
+ * @brief Bits de x > 0.
+ */
+inline std::size_t bit_length(const BigInt &x) {
+  return static_cast<std::size_t>(boost::multiprecision::msb(x)) + 1;
+}
+
+/**
+ * @brief floor(2^(2n) / d) para d de exactamente n bits, con Newton.
+ *
+ * El inverso de la mitad alta de d (h ~ n/2 bits) da la mitad de los bits
+ * correctos; un paso de Newton, x' = 2x - d x^2 / 2^(2n), los duplica, y
+ * el resto r = 2^(2n) - d x corrige las últimas unidades.
+ */
+inline BigInt newton_reciprocal(const BigInt &d, std::size_t n) {
+  const BigInt one_shifted = BigInt(1) << (2 * n);
+  if (n <= RADIX_DIRECT_INVERSE_BITS) {
+    return one_shifted / d;
+  }
+  const std::size_t h = n / 2 + RADIX_NEWTON_GUARD_BITS;
+  const BigInt xh = newton_reciprocal(d >> (n - h), h); // ~2^(2h) / d_alta
+  // x = 2 * (xh << (n - h)) - (d * (xh << (n - h))^2 >> 2n)
+  BigInt x = (xh << (n - h + 1)) - ((d * (xh * xh)) >> (2 * h));
+  BigInt r = one_shifted - d * x;
+  while (r < 0) {
+    --x;
+    r += d;
+  }
+  while (r >= d) {
+    ++x;
+    r -= d;
+  }
+  return x;
+}
+
+/**
+ * @brief Nivel k de la caché: 10^(RADIX_LEAF_DIGITS * 2^k) y su inverso.
+ */
+struct DecimalRadixLevel {
+  BigInt power;
+  std::size_t bits = 0;
+  BigInt inverse; // floor(2^(2 bits) / power); 0 = aún no calculado
+};
+
+/**
+ * @brief Nivel k de la caché del hilo, ampliándola con cuadrados.
+ *
+ * `std::deque` no mueve los elementos al crecer: las referencias que
+ * guardan los niveles superiores de la recursión siguen siendo válidas.
+ */
+inline DecimalRadixLevel &decimal_radix_level(std::size_t k) {
+  thread_local std::deque<DecimalRadixLevel> ladder;
+  if (ladder.empty()) {
+    DecimalRadixLevel leaf;
+    leaf.power = boost::multiprecision::pow(
+        BigInt(10), static_cast<unsigned>(RADIX_LEAF_DIGITS));
+    leaf.bits = bit_length(leaf.power);
+    ladder.push_back(std::move(leaf));
+  }
+  while (ladder.size() <= k) {
+    DecimalRadixLevel next;
+    next.power = ladder.back().power * ladder.back().power;
+    next.bits = bit_length(next.power);
+    ladder.push_back(std::move(next));
+  }
+  return ladder[k];
+}
+
+/**
+ * @brief q = x / P_k y r = x % P_k para 0 <= x < P_k^2 (Barrett).
+ */
+inline void divide_by_radix_level(const BigInt &x, std::size_t k, BigInt &q,
+                                  BigInt &r) {
+  DecimalRadixLevel &level = decimal_radix_level(k);
+  if (level.inverse == 0) {
+    level.inverse = newton_reciprocal(level.power, level.bits);
+  }
+  // inv <= 2^(2b) / P, así que q nunca se pasa; se queda corto en <= 2
+  q = (x * level.inverse) >> (2 * level.bits);
+  r = x - q * level.power;
+  while (r >= level.power) {
+    r -= level.power;
+    ++q;
+  }
+}
+
+/**
+ * @brief Escribe v < 10^9 con exactamente 9 cifras terminando en `end`.
+ */
+inline char *write_limb_backward(char *end, std::uint32_t v) noexcept {
+  for (int i = 0; i < 4; ++i) {
+    const std::uint32_t pair = v % 100;
+    v /= 100;
+    end -= 2;
+    std::memcpy(end, &DECIMAL_DIGIT_PAIRS[2 * pair], 2);
+  }
+  *--end = static_cast<char>('0' + v);
+  return end;
+}
+
+/**
+ * @brief Hoja: escribe v < 10^RADIX_LEAF_DIGITS terminando en `end` con el
+ * método clásico (divisiones por 10^9 sobre limbs de 32 bits).
+ *
+ * @param pad true: exactamente RADIX_LEAF_DIGITS cifras; false: sin ceros
+ *            a la izquierda (al menos una cifra).
+ * @return El puntero a la primera cifra escrita.
+ */
+inline char *write_leaf_backward(const BigInt &v, char *end, bool pad) {
+  thread_local std::vector<std::uint32_t> limbs;
+  limbs.clear();
+  boost::multiprecision::export_bits(v, std::back_inserter(limbs), 32, false);
+  std::size_t size = limbs.size();
+  while (size != 0 && limbs[size - 1] == 0) {
+    --size;
+  }
+  char *const leaf_end = end;
+  while (size != 0) {
+    std::uint64_t remainder = 0;
+    for (std::size_t i = size; i-- > 0;) {
+      const std::uint64_t current = (remainder << 32) | limbs[i];
+      limbs[i] = static_cast<std::uint32_t>(current / RADIX_LIMB_BASE);
+      remainder = current % RADIX_LIMB_BASE;
+    }
+    while (size != 0 && limbs[size - 1] == 0) {
+      --size;
+    }
+    auto block = static_cast<std::uint32_t>(remainder);
+    if (size != 0 || pad) {
+      end = write_limb_backward(end, block);
+    } else {
+      do { // Bloque más alto: sin ceros de relleno
+        *--end = static_cast<char>('0' + block % 10);
+        block /= 10;
+      } while (block != 0);
+    }
+  }
+  if (pad) {
+    while (end != leaf_end - RADIX_LEAF_DIGITS) {
+      *--end = '0';
+    }
+  } else if (end == leaf_end) { // v == 0
+    *--end = '0';
+  }
+  return end;
+}
+
+/**
+ * @brief Escribe v < P_k con exactamente RADIX_LEAF_DIGITS * 2^k cifras
+ * terminando en `end`.
+ */
+inline void write_padded_backward(const BigInt &v, std::size_t k, char *end) {
+  if (k == 0) {
+    write_leaf_backward(v, end, true);
+    return;
+  }
+  BigInt q;
+  BigInt r;
+  divide_by_radix_level(v, k - 1, q, r);
+  write_padded_backward(r, k - 1, end);
+  write_padded_backward(q, k - 1, end - (RADIX_LEAF_DIGITS << (k - 1)));
+}
+
+/**
+ * @brief Escribe v >= 0 (sin ceros a la izquierda) terminando en `end`.
+ * @return El puntero a la primera cifra escrita.
+ */
+inline char *write_decimal_backward(const BigInt &v, char *end) {
+  if (v < decimal_radix_level(0).power) {
+    return write_leaf_backward(v, end, false);
+  }
+  // Mayor k con P_k <= v (así v < P_{k+1} = P_k^2). P_{k+1} tiene al
+  // menos 2 * (bits(P_k) - 1) + 1 bits: sólo se calcula si puede ser <= v.
+  const std::size_t bits = bit_length(v);
+  std::size_t k = 0;
+  while (2 * decimal_radix_level(k).bits - 1 <= bits &&
+         decimal_radix_level(k + 1).power <= v) {
+    ++k;
+  }
+  BigInt q;
+  BigInt r;
+  divide_by_radix_level(v, k, q, r);
+  write_padded_backward(r, k, end);
+  return write_decimal_backward(q, end - (RADIX_LEAF_DIGITS << k));
+}
+
+/**
+ * @brief Valor de n <= 9 cifras ASCII (ya validadas).
+ */
+inline std::uint32_t parse_limb(const char *p, std::size_t n) noexcept {
+  if (n == RADIX_LIMB_DIGITS) {
+    return static_cast<std::uint32_t>((p[0] - '0') * POW10_8 +
+                                      parse_eight_digits(p + 1));
+  }
+  std::uint32_t value = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    value = value * 10 + static_cast<std::uint32_t>(p[i] - '0');
+  }
+  return value;
+}
+
+/**
+ * @brief Hoja: n <= RADIX_LEAF_DIGITS cifras a BigInt con el método
+ * clásico (limbs = limbs * 10^9 + bloque).
+ */
+inline BigInt parse_leaf(const char *p, std::size_t n) {
+  thread_local std::vector<std::uint32_t> limbs;
+  limbs.clear();
+  std::size_t chunk = n % RADIX_LIMB_DIGITS;
+  if (chunk == 0) {
+    chunk = RADIX_LIMB_DIGITS;
+  }
+  std::uint32_t scale = 1;
+  for (std::size_t i = 0; i < chunk; ++i) {
+    scale *= 10;
+  }
+  for (const char *const end = p + n; p != end;
+       p += chunk, chunk = RADIX_LIMB_DIGITS, scale = RADIX_LIMB_BASE) {
+    std::uint64_t carry = parse_limb(p, chunk);
+    for (std::uint32_t &limb : limbs) {
+      const std::uint64_t current = std::uint64_t{limb} * scale + carry;
+      limb = static_cast<std::uint32_t>(current);
+      carry = current >> 32;
+    }
+    if (carry != 0) {
+      limbs.push_back(static_cast<std::uint32_t>(carry));
+    }
+  }
+  BigInt value;
+  if (!limbs.empty()) { // import_bits no admite un rango vacío
+    boost::multiprecision::import_bits(value, limbs.begin(), limbs.end(), 32,
+                                       false);
+  }
+  return value;
+}
+
+/**
+ * @brief n cifras ASCII (ya validadas) a BigInt: alta * P_k + baja, con
+ * la parte baja de RADIX_LEAF_DIGITS * 2^k cifras.
+ */
+inline BigInt parse_decimal(const char *p, std::size_t n) {
+  if (n <= RADIX_LEAF_DIGITS) {
+    return parse_leaf(p, n);
+  }
+  std::size_t k = 0;
+  while ((RADIX_LEAF_DIGITS << (k + 1)) < n) {
+    ++k;
+  }
+  const std::size_t low_digits = RADIX_LEAF_DIGITS << k;
+  BigInt value = parse_decimal(p, n - low_digits);
+  value *= decimal_radix_level(k).power;
+  value += parse_decimal(p + n - low_digits, low_digits);
+  return value;
+}
+
+/**
+ * @brief Cota superior de las cifras de |v| (bits * log10(2) + 1).
+ */
+template <typename T> std::size_t decimal_length_bound(const T &v) {
+  if (v == 0) {
+    return 1;
+  }
+  T magnitude = v;
+  if constexpr (std::numeric_limits<T>::is_signed) {
+    if (magnitude < 0) {
+      magnitude = -magnitude;
+    }
+  }
+  const auto bits =
+      static_cast<std::size_t>(boost::multiprecision::msb(magnitude)) + 1;
+  return bits * 30103 / 100000 + 1; // 0.30103 > log10(2)
+}
+
+} // namespace internal
+
+/**
+ * @brief Escribe `value` (tipo de Boost) en base 10 en [first, last).
+ *
+ * Misma semántica que `std::to_chars`: sin '\0'; si no cabe, devuelve
+ * {last, std::errc::value_too_large}. Si el buffer tiene al menos
+ * `bits * log10(2) + 2` caracteres se escribe directamente en él.
+ *
+ * @test_property to_chars(buf, end, cpp_int(1) << 100) escribe
+ *                "1267650600228229401496703205376"
+ *
+ * @optimize_note Divide y vencerás con divisiones de Barrett: un millón de
+ *                cifras en ~0.5 s frente a ~8.8 s de `cpp_int::str()` (6x
+ *                con 10^5 cifras; empate por debajo de ~10^3); ver
+ *                benchmarks/bench_radix_conversion.cpp.
+ */
+template <typename T,
+          std::enable_if_t<is_boost_integer_v<T>, int> = 0>
+std::to_chars_result to_chars(char *first, char *last, const T &value) {
+  const auto room = static_cast<std::size_t>(last - first);
+  if constexpr (!internal::is_cpp_int_number<T>::value) {
+    const std::string text = value.str();
+    if (room < text.size()) {
+      return {last, std::errc::value_too_large};
+    }
+    std::memcpy(first, text.data(), text.size());
+    return {first + text.size(), std::errc{}};
+  } else {
+    internal::BigInt magnitude(value);
+    const bool negative = magnitude < 0;
+    if (negative) {
+      magnitude = -magnitude;
+    }
+    const std::size_t bound = internal::decimal_length_bound(magnitude);
+    // Las cifras se escriben hacia atrás desde el final de la cota
+    std::string scratch;
+    char *area_end = first + negative + bound;
+    if (room < negative + bound) {
+      scratch.resize(bound);
+      area_end = &scratch[0] + bound;
+    }
+    const char *const begin =
+        internal::write_decimal_backward(magnitude, area_end);
+    const auto length = static_cast<std::size_t>(area_end - begin);
+    if (room < negative + length) {
+      return {last, std::errc::value_too_large};
+    }
+    if (negative) {
+      *first++ = '-';
+    }
+    std::memmove(first, begin, length);
+    return {first + length, std::errc{}};
+  }
+}
+
+/**
+ * @brief Lee un valor de un tipo de Boost en base 10 del principio de
+ * [first, last).
+ *
+ * Misma semántica que `std::from_chars`: '-' sólo en tipos con signo, sin
+ * '+' ni espacios; los ceros a la izquierda son decimales (no octal, a
+ * diferencia del constructor de Boost desde cadena). En los tipos acotados
+ * un valor fuera de rango es std::errc::result_out_of_range (no se reduce
+ * módulo 2^n).
+ *
+ * @test_property from_chars("-0012") (int256_t) == -12
+ *
+ * @optimize_note Divide y vencerás con productos de Karatsuba: un millón
+ *                de cifras en ~0.15 s frente a ~1 s del constructor de
+ *                `cpp_int` (empate hacia 10^4 cifras); ver
+ *                benchmarks/bench_radix_conversion.cpp.
+ */
+template <typename T,
+          std::enable_if_t<is_boost_integer_v<T>, int> = 0>
+std::from_chars_result from_chars(const char *first, const char *last,
+                                  T &value) {
+  const bool negative = first != last && *first == '-';
+  if (negative && !std::numeric_limits<T>::is_signed) {
+    return {first, std::errc::invalid_argument};
+  }
+  const char *digits = first + negative;
+  const char *const end = internal::skip_digits(digits, last);
+  if (end == digits) {
+    return {first, std::errc::invalid_argument};
+  }
+  while (end - digits > 1 && *digits == '0') {
+    ++digits;
+  }
+  const auto length = static_cast<std::size_t>(end - digits);
+  if constexpr (std::numeric_limits<T>::is_bounded) {
+    if (length >
+        static_cast<std::size_t>(std::numeric_limits<T>::digits10) + 1) {
+      return {end, std::errc::result_out_of_range};
+    }
+  }
+
+  if constexpr (internal::is_cpp_int_number<T>::value) {
+    internal::BigInt parsed = internal::parse_decimal(digits, length);
+    if (negative) {
+      parsed = -parsed;
+    }
+    if constexpr (std::numeric_limits<T>::is_bounded) {
+      if (parsed > std::numeric_limits<T>::max() ||
+          parsed < std::numeric_limits<T>::min()) {
+        return {end, std::errc::result_out_of_range};
+      }
+    }
+    if constexpr (std::is_same_v<T, internal::BigInt>) {
+      value = std::move(parsed);
+    } else {
+      value = static_cast<T>(parsed);
+    }
+  } else {
+    std::string text(negative ? "-" : "");
+    text.append(digits, end);
+    value = T(text);
+  }
+  return {end, std::errc{}};
+}
+
+#endif // HAS_BOOST_MULTIPRECISION
+
+/**
+ * @brief Representación decimal de cualquier entero soportado.
+ *
+ * Tipos de Boost: una sola reserva (cota por número de bits) y
+ * `to_chars` por divide y vencerás. Nativos y 128 bits: `to_chars` sobre
+ * un buffer en la pila.
+ *
+ * @test_property to_string(-42) == "-42"
+ * @test_property to_string(uint128_max) == "340282366920938463463374607431768211455"
+ */
+template <typename T,
+          std::enable_if_t<is_supported_integer_v<T>, int> = 0>
+std::string to_string(const T &value) {
+#if HAS_BOOST_MULTIPRECISION
+  if constexpr (is_boost_integer_v<T>) {
+    std::string text(internal::decimal_length_bound(value) + 1, '\0');
+    char *const first = &text[0];
+    const auto result = to_chars(first, first + text.size(), value);
+    text.resize(static_cast<std::size_t>(result.ptr - first));
+    return text;
+  } else
+#endif
+  {
+    char buffer[41]; // 39 cifras y signo para 128 bits
+    std::to_chars_result result{};
+    if constexpr (is_native_int128_v<T>) {
+      result = core::to_chars(buffer, buffer + sizeof(buffer), value);
+    } else {
+      result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    }
+    return std::string(buffer, result.ptr);
+  }
+}
+
+/**
+ * @brief Lee un entero soportado de `text` (base 10, '+' o '-' opcional).
+ *
+ * Se exige consumir el texto entero.
+ *
+ * @return Un `core::Expected<T>`:
+ * - .value() con el valor.
+ * - .error() (MathError::Overflow) si no cabe en T.
+ * - .error() (MathError::DomainError) si el formato no es válido.
+ *
+ * @test_property from_string<int>("+17") == 17
+ * @test_property from_string<uint8_t>("256") == MathError::Overflow
+ * @test_property from_string<int>("12ab") == MathError::DomainError
+ */
+template <typename T,
+          std::enable_if_t<is_supported_integer_v<T>, int> = 0>
+Expected<T> from_string(std::string_view text) {
+  const char *first = text.data();
+  const char *const last = text.data() + text.size();
+  if (text.size() > 1 && text[0] == '+' && text[1] != '-') {
+    ++first;
+  }
+  T value{};
+  std::from_chars_result result{};
+#if HAS_BOOST_MULTIPRECISION
+  if constexpr (is_boost_integer_v<T>) {
+    result = core::from_chars(first, last, value);
+  } else
+#endif
+  if constexpr (is_native_int128_v<T>) {
+    result = core::from_chars(first, last, value);
+  } else {
+    result = std::from_chars(first, last, value);
+  }
+  if (result.ec == std::errc::result_out_of_range && result.ptr == last) {
+    return Unexpected(MathError::Overflow);
+  }
+  if (result.ec != std::errc{} || result.ptr != last) {
+    return Unexpected(MathError::DomainError);
+  }
+  return value;
+}
+
+} // namespace numbers_calculations::core
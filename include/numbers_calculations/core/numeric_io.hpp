@@ -13,17 +13,51 @@
  * - Soporte completo de E/S para `__int128`.
  * - Manejo de errores para `istream` usando `failbit`.
  *
- * @todo_feature Extender para que funcione con tipos de Boost.Multiprecision.
+ * La conversión en sí está en `to_chars` / `from_chars` (misma semántica que
+ * las de `<charconv>`, base 10), que escriben y leen en un buffer del
+ * llamador sin reservar memoria. Los operadores de stream se apoyan en ellas.
+ *
+ * Explicación didáctica:
+ * La forma "de libro" de formatear un uint128_t es `% 10` y `/ 10` por
+ * cifra: 39 cifras son 78 llamadas a `__umodti3` / `__udivti3` (no hay
+ * división de 128 bits en hardware). Aquí se divide por 10^19 (como mucho
+ * dos veces) y cada trozo de 19 cifras cabe en un uint64_t, donde la
+ * división por una constante es una multiplicación. Además cada paso saca
+ * dos cifras (`% 100`) de una tabla de 200 caracteres "00".."99".
+ *
+ * Al leer, el coste "de libro" es `val * 10 + cifra` por carácter. Aquí se
+ * cargan 8 caracteres en un uint64_t y se validan y convierten a la vez
+ * (SWAR, "SIMD within a register"), o 16 en un registro SSE4.1 si el
+ * compilador lo permite; los bloques se combinan con productos
+ * 64x64 -> 128 y el overflow sale del número de cifras.
+ *
+ * Para los tipos de Boost.Multiprecision, ver `multiprecision_io.hpp`.
  * ==============================================================================
  */
 
-#include <algorithm> // Para std::reverse
+#include <charconv> // Para std::to_chars_result y std::from_chars_result
+#include <cstddef>  // Para std::size_t
+#include <cstdint>  // Para std::uint64_t
+#include <cstring>  // Para std::memcpy
 #include <istream>
 #include <limits> // Para std::numeric_limits
 #include <numbers_calculations/core/extended_type_traits.hpp>
 #include <ostream>
 #include <string>
-#include <vector>
+#include <string_view> // Para respetar width/fill al escribir
+#include <system_error> // Para std::errc
+
+// --- Detección del orden de bytes (los trucos SWAR suponen little-endian) ---
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) &&              \
+    __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define HAS_BIG_ENDIAN_BYTES
+#endif
+
+// --- Detección de SSE4.1 (16 cifras por registro) ---
+#if defined(__SSE4_1__)
+#include <immintrin.h>
+#define HAS_SSE41_DECIMAL
+#endif
 
 namespace numbers_calculations::core {
 
@@ -31,122 +65,458 @@ namespace numbers_calculations::core {
 #if HAS_NATIVE_INT128
 std::ostream &operator<<(std::ostream &os, const uint128_t &val);
 std::ostream &operator<<(std::ostream &os, const int128_t &val);
+std::istream &operator>>(std::istream &is, int128_t &val);
+std::istream &operator>>(std::istream &is, uint128_t &val);
 #endif
 
-#if HAS_NATIVE_INT128
+namespace internal {
+
+// --- Cifras por bloques (no depende de __int128) ---
+
+// Cifras de 00 a 99, dos caracteres por entrada.
+inline constexpr char DECIMAL_DIGIT_PAIRS[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+inline constexpr std::uint64_t POW10_8 = 100000000ULL;
+inline constexpr std::uint64_t POW10_16 = 10000000000000000ULL;
+
+// Constantes SWAR: 8 bytes con el mismo valor.
+inline constexpr std::uint64_t SWAR_ZEROS = 0x3030303030303030ULL; // "00000000"
+inline constexpr std::uint64_t SWAR_HIGH_BITS = 0x8080808080808080ULL;
+inline constexpr std::uint64_t SWAR_NINE_GUARD = 0x4646464646464646ULL;
 
 /**
- * @brief Sobrecarga del operador de salida (<<) para `uint128_t`.
- * Permite imprimir valores de 128 bits sin signo en un `std::ostream`.
+ * @brief Carga 8 bytes de `p` como uint64_t con el primer carácter en el
+ * byte bajo (orden little-endian, sea cual sea la máquina).
  */
-inline std::ostream &operator<<(std::ostream &os, const uint128_t &val) {
-  if (val == 0) {
-    os << '0';
-    return os;
+inline std::uint64_t load_u64_le(const char *p) noexcept {
+  std::uint64_t word;
+  std::memcpy(&word, p, sizeof(word));
+#if defined(HAS_BIG_ENDIAN_BYTES)
+  word = __builtin_bswap64(word);
+#endif
+  return word;
+}
+
+/**
+ * @brief Índice del primer byte (desde el bajo) con el bit alto a 1.
+ * @pre mask != 0 y sólo tiene bits altos de byte.
+ */
+inline unsigned int first_marked_byte(std::uint64_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned int>(__builtin_ctzll(mask)) / 8;
+#else
+  unsigned int i = 0;
+  while ((mask & 0x80) == 0) {
+    mask >>= 8;
+    ++i;
   }
+  return i;
+#endif
+}
 
-  // Convertimos el número a una cadena de caracteres manualmente.
-  std::string s;
-  s.reserve(40); // Suficiente para 2^128 - 1
-  uint128_t temp = val;
+/**
+ * @brief Marca (bit alto a 1) los bytes de `word` que no son '0'..'9'.
+ *
+ * Byte b: b - '0' se pasa de 0x7F por abajo si b < '0', y b + 0x46 se pasa
+ * por arriba si b > '9'. Los acarreos sólo suben, así que el primer byte
+ * marcado es exactamente el primer carácter que no es cifra.
+ */
+inline std::uint64_t non_digit_mask(std::uint64_t word) noexcept {
+  return ((word + SWAR_NINE_GUARD) | (word - SWAR_ZEROS)) & SWAR_HIGH_BITS;
+}
 
-  while (temp > 0) {
-    s += (temp % 10) + '0';
-    temp /= 10;
-  }
+/**
+ * @brief Convierte 8 cifras ASCII (ya validadas) en paralelo (SWAR).
+ *
+ * Tres pasos de "multiplica y suma vecinos": pares de cifras (x10),
+ * grupos de 4 (x100) y el grupo de 8 (x10^4), con 3 multiplicaciones en
+ * lugar de 8 multiplicaciones dependientes.
+ */
+inline std::uint64_t parse_eight_digits(const char *p) noexcept {
+  constexpr std::uint64_t mask = 0x000000FF000000FFULL;
+  constexpr std::uint64_t mul1 = 100 + (1000000ULL << 32);
+  constexpr std::uint64_t mul2 = 1 + (10000ULL << 32);
+  std::uint64_t word = load_u64_le(p) - SWAR_ZEROS;
+  word = word * 10 + (word >> 8); // Pares de cifras en bytes alternos
+  return (((word & mask) * mul1) + (((word >> 16) & mask) * mul2)) >> 32;
+}
 
-  std::reverse(s.begin(), s.end());
-  os << s;
-  return os;
+/**
+ * @brief Convierte 16 cifras ASCII (ya validadas) a uint64_t.
+ */
+inline std::uint64_t parse_sixteen_digits(const char *p) noexcept {
+#if defined(HAS_SSE41_DECIMAL)
+  // Lo mismo que parse_eight_digits, pero con los 16 bytes en un registro
+  const __m128i digits = _mm_sub_epi8(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)),
+      _mm_set1_epi8('0'));
+  const __m128i pairs = _mm_maddubs_epi16( // 8 x [0, 99]
+      digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1,
+                            10, 1));
+  const __m128i quads = _mm_madd_epi16( // 4 x [0, 9999]
+      pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+  const __m128i packed = _mm_packus_epi32(quads, quads);
+  const __m128i octets = _mm_madd_epi16( // 2 x [0, 10^8)
+      packed, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+  return static_cast<std::uint64_t>(_mm_cvtsi128_si32(octets)) * POW10_8 +
+         static_cast<std::uint32_t>(_mm_extract_epi32(octets, 1));
+#else
+  return parse_eight_digits(p) * POW10_8 + parse_eight_digits(p + 8);
+#endif
 }
 
 /**
- * @brief Sobrecarga del operador de salida (<<) para `int128_t`.
- * Permite imprimir valores de 128 bits con signo en un `std::ostream`.
+ * @brief Primer carácter de [p, last) que no es una cifra.
+ *
+ * Comprueba 16 bytes por iteración con SSE4.1 o 8 con SWAR; sólo la cola
+ * (< 8 bytes) va carácter a carácter.
  */
-inline std::ostream &operator<<(std::ostream &os, const int128_t &val) {
-  if (val == 0) {
-    os << '0';
-    return os;
+inline const char *skip_digits(const char *p, const char *last) noexcept {
+#if defined(HAS_SSE41_DECIMAL)
+  const __m128i zero = _mm_set1_epi8('0');
+  const __m128i nine = _mm_set1_epi8(9);
+  while (last - p >= 16) {
+    const __m128i digits = _mm_sub_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), zero);
+    // Cifra <=> (byte - '0') sin signo <= 9 <=> max(byte - '0', 9) == 9
+    const auto ok = static_cast<unsigned int>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_max_epu8(digits, nine), nine)));
+    if (ok != 0xFFFF) {
+      return p + __builtin_ctz(~ok);
+    }
+    p += 16;
   }
-
-  // Manejar el caso del valor mínimo, que no tiene un positivo equivalente.
-  if (val == std::numeric_limits<int128_t>::min()) {
-    os << "-170141183460469231731687303715884105728";
-    return os;
+#endif
+  while (last - p >= 8) {
+    const std::uint64_t mask = non_digit_mask(load_u64_le(p));
+    if (mask != 0) {
+      return p + first_marked_byte(mask);
+    }
+    p += 8;
+  }
+  while (p != last && static_cast<unsigned char>(*p - '0') < 10) {
+    ++p;
   }
+  return p;
+}
 
-  std::string s;
-  s.reserve(41); // 40 dígitos + signo
-  int128_t temp = val;
+} // namespace internal
 
-  if (temp < 0) {
-    os << '-';
-    temp = -temp; // Ahora podemos tratarlo como positivo
-  }
+#if HAS_NATIVE_INT128
 
-  while (temp > 0) {
-    s += (temp % 10) + '0';
-    temp /= 10;
-  }
+namespace internal {
+
+// Mayor potencia de 10 que cabe en un uint64_t: trozos de 19 cifras al
+// formatear.
+inline constexpr std::uint64_t POW10_19 = 10000000000000000000ULL;
 
-  std::reverse(s.begin(), s.end());
-  os << s;
-  return os;
+// Cifras de 2^128 - 1 (el signo de int128_t va aparte).
+inline constexpr std::size_t UINT128_MAX_DIGITS = 39;
+
+/**
+ * @brief Escribe v (sin ceros a la izquierda) terminando en `end`.
+ * @return El puntero a la primera cifra escrita.
+ */
+inline char *write_u64_backward(char *end, std::uint64_t v) noexcept {
+  while (v >= 100) {
+    const std::uint64_t pair = v % 100;
+    v /= 100;
+    end -= 2;
+    std::memcpy(end, &DECIMAL_DIGIT_PAIRS[2 * pair], 2);
+  }
+  if (v >= 10) {
+    end -= 2;
+    std::memcpy(end, &DECIMAL_DIGIT_PAIRS[2 * v], 2);
+  } else {
+    *--end = static_cast<char>('0' + v);
+  }
+  return end;
 }
 
 /**
- * @brief Sobrecarga del operador de entrada (>>) para `int128_t`.
- * Permite leer valores de 128 bits con signo desde un `std::istream`.
- * Maneja overflow y formato inválido estableciendo el `failbit` del stream.
+ * @brief Escribe exactamente 19 cifras de v < 10^19 (con ceros a la
+ * izquierda) terminando en `end`.
  */
-inline std::istream &operator>>(std::istream &is, int128_t &val) {
-  std::string s;
-  is >> s; // Leemos la entrada como una cadena
+inline char *write_u64_chunk_backward(char *end, std::uint64_t v) noexcept {
+  for (int i = 0; i < 9; ++i) {
+    const std::uint64_t pair = v % 100;
+    v /= 100;
+    end -= 2;
+    std::memcpy(end, &DECIMAL_DIGIT_PAIRS[2 * pair], 2);
+  }
+  *--end = static_cast<char>('0' + v);
+  return end;
+}
 
-  if (s.empty()) {
-    is.setstate(std::ios_base::failbit);
-    return is;
+/**
+ * @brief Escribe v terminando en `end` (en trozos de 10^19).
+ * @return El puntero a la primera cifra escrita.
+ */
+inline char *write_u128_backward(char *end, uint128_t v) noexcept {
+  constexpr std::uint64_t u64_max = std::numeric_limits<std::uint64_t>::max();
+  if (v <= u64_max) {
+    return write_u64_backward(end, static_cast<std::uint64_t>(v));
+  }
+  // v >= 2^64 > 10^19: al menos un trozo completo de 19 cifras
+  uint128_t high = v / POW10_19;
+  end = write_u64_chunk_backward(
+      end, static_cast<std::uint64_t>(v - high * POW10_19));
+  if (high > u64_max) {
+    const uint128_t top = high / POW10_19;
+    end = write_u64_chunk_backward(
+        end, static_cast<std::uint64_t>(high - top * POW10_19));
+    high = top; // < 10^1 (2^128 < 10^39)
   }
+  return write_u64_backward(end, static_cast<std::uint64_t>(high));
+}
+
+// 2^128 - 1, para la única comparación de overflow (con 39 cifras).
+inline constexpr char UINT128_MAX_DECIMAL[] =
+    "340282366920938463463374607431768211455";
 
-  val = 0;
-  size_t i = 0;
-  bool is_negative = false;
+// Resultado de leer las cifras decimales de un prefijo.
+struct DecimalParse {
+  const char *end;   // Primer carácter que no es cifra
+  uint128_t value;   // Válido sólo si hay cifras y no hay overflow
+  bool has_digits;
+  bool overflow;     // El número no cabe en 128 bits
+};
 
-  if (s[0] == '-') {
-    is_negative = true;
-    i = 1;
-  } else if (s[0] == '+') {
-    i = 1;
+/**
+ * @brief Lee el prefijo de cifras de [first, last).
+ *
+ * Dos pasadas: `skip_digits` valida y localiza el final; después se
+ * convierte en bloques de 16 cifras (uint64_t) que se combinan con
+ * multiplicaciones 64x64 -> 128 (`value * 10^16 + bloque`, como mucho dos
+ * veces). El overflow se decide por el número de cifras significativas y,
+ * sólo con 39, una comparación con "2^128 - 1".
+ */
+inline DecimalParse parse_decimal_u128(const char *first,
+                                       const char *last) noexcept {
+  const char *p = first;
+  while (last - p >= 8 && load_u64_le(p) == SWAR_ZEROS) { // "00000000"
+    p += 8;
+  }
+  while (p != last && *p == '0') { // Los ceros a la izquierda no cuentan
+    ++p;
+  }
+  const char *const significant = p;
+  p = skip_digits(p, last);
+  DecimalParse result{p, 0, p != first, false};
+  const auto length = static_cast<std::size_t>(p - significant);
+  if (length > UINT128_MAX_DIGITS ||
+      (length == UINT128_MAX_DIGITS &&
+       std::memcmp(significant, UINT128_MAX_DECIMAL, UINT128_MAX_DIGITS) > 0)) {
+    result.overflow = true;
+    return result;
   }
 
-  if (i == s.length()) { // Solo había un signo
-    is.setstate(std::ios_base::failbit);
-    return is;
+  // Cabeza de length % 16 cifras; el resto son bloques completos de 16
+  const std::size_t head = length % 16;
+  const char *digits = significant;
+  std::uint64_t head_value = 0;
+  for (const char *stop = digits + head % 8; digits != stop; ++digits) {
+    head_value = head_value * 10 + static_cast<std::uint64_t>(*digits - '0');
+  }
+  if (head >= 8) {
+    head_value = head_value * POW10_8 + parse_eight_digits(digits);
+    digits += 8;
+  }
+  uint128_t value = head_value;
+  for (; digits != p; digits += 16) {
+    value = value * POW10_16 + parse_sixteen_digits(digits);
   }
+  result.value = value;
+  return result;
+}
 
-  for (; i < s.length(); ++i) {
-    if (s[i] < '0' || s[i] > '9') { // Caracter no numérico
-      is.setstate(std::ios_base::failbit);
-      return is;
-    }
+} // namespace internal
 
-    int digit = s[i] - '0';
-    // Comprobación de overflow antes de multiplicar
-    if (val > (std::numeric_limits<int128_t>::max() - digit) / 10) {
-      is.setstate(std::ios_base::failbit);
-      return is;
+/**
+ * @brief Escribe `value` en base 10 en [first, last), sin reservar memoria.
+ *
+ * Misma semántica que `std::to_chars`: no añade '\0' y, si no cabe,
+ * devuelve {last, std::errc::value_too_large} (el contenido de
+ * [first, last) queda sin especificar).
+ *
+ * @return {puntero tras la última cifra, std::errc{}} si cabe.
+ *
+ * @test_property to_chars(buf, buf + 39, 2^128 - 1) escribe
+ *                "340282366920938463463374607431768211455"
+ *
+ * @optimize_note ~2 divisiones de 128 bits por número (frente a 2 por
+ *                cifra) y dos cifras por paso; ver
+ *                benchmarks/bench_int128_io.cpp.
+ */
+inline std::to_chars_result to_chars(char *first, char *last,
+                                     uint128_t value) noexcept {
+  char buffer[internal::UINT128_MAX_DIGITS];
+  char *const end = buffer + internal::UINT128_MAX_DIGITS;
+  const char *const begin = internal::write_u128_backward(end, value);
+  const auto length = end - begin;
+  if (last - first < length) {
+    return {last, std::errc::value_too_large};
+  }
+  std::memcpy(first, begin, static_cast<std::size_t>(length));
+  return {first + length, std::errc{}};
+}
+
+/**
+ * @brief Escribe `value` en base 10 (con '-' si es negativo) en
+ * [first, last), sin reservar memoria.
+ *
+ * @test_property to_chars(buf, buf + 40, INT128_MIN) escribe
+ *                "-170141183460469231731687303715884105728"
+ */
+inline std::to_chars_result to_chars(char *first, char *last,
+                                     int128_t value) noexcept {
+  // |value| en aritmética sin signo (válido también para el mínimo)
+  uint128_t magnitude = static_cast<uint128_t>(value);
+  if (value < 0) {
+    if (first == last) {
+      return {last, std::errc::value_too_large};
     }
-    val = val * 10 + digit;
+    *first++ = '-';
+    magnitude = uint128_t{0} - magnitude;
   }
+  return to_chars(first, last, magnitude);
+}
+
+/**
+ * @brief Lee un uint128_t en base 10 del principio de [first, last).
+ *
+ * Misma semántica que `std::from_chars`: sin espacios ni '+' iniciales;
+ * consume el prefijo de cifras más largo.
+ *
+ * @return Un `std::from_chars_result`:
+ * - {fin de las cifras, std::errc{}} y `value` asignado si todo va bien.
+ * - {first, std::errc::invalid_argument} si no empieza por una cifra.
+ * - {fin de las cifras, std::errc::result_out_of_range} si no cabe.
+ * En caso de error `value` no se modifica.
+ *
+ * @test_property from_chars("123abc") == 123, ptr apunta a "abc"
+ * @test_property from_chars("340282366920938463463374607431768211456")
+ *                == std::errc::result_out_of_range
+ *
+ * @optimize_note 8 cifras por paso (SWAR) o 16 con SSE4.1 (-msse4.1): ~2x
+ *                más rápida que `val * 10 + cifra` con 20 cifras y ~3-4x
+ *                con 29-39; ver benchmarks/bench_int128_io.cpp.
+ */
+inline std::from_chars_result from_chars(const char *first, const char *last,
+                                         uint128_t &value) noexcept {
+  const internal::DecimalParse parsed =
+      internal::parse_decimal_u128(first, last);
+  if (!parsed.has_digits) {
+    return {first, std::errc::invalid_argument};
+  }
+  if (parsed.overflow) {
+    return {parsed.end, std::errc::result_out_of_range};
+  }
+  value = parsed.value;
+  return {parsed.end, std::errc{}};
+}
 
-  if (is_negative) {
-    val = -val;
+/**
+ * @brief Lee un int128_t en base 10 (con '-' opcional) del principio de
+ * [first, last). Misma semántica que la versión sin signo.
+ *
+ * @test_property from_chars("-170141183460469231731687303715884105728")
+ *                == INT128_MIN
+ */
+inline std::from_chars_result from_chars(const char *first, const char *last,
+                                         int128_t &value) noexcept {
+  const bool negative = first != last && *first == '-';
+  const internal::DecimalParse parsed =
+      internal::parse_decimal_u128(first + negative, last);
+  if (!parsed.has_digits) {
+    return {first, std::errc::invalid_argument};
   }
+  // |INT128_MIN| = 2^127 = INT128_MAX + 1
+  const uint128_t limit =
+      static_cast<uint128_t>(std::numeric_limits<int128_t>::max()) + negative;
+  if (parsed.overflow || parsed.value > limit) {
+    return {parsed.end, std::errc::result_out_of_range};
+  }
+  value = static_cast<int128_t>(negative ? uint128_t{0} - parsed.value
+                                         : parsed.value);
+  return {parsed.end, std::errc{}};
+}
 
+/**
+ * @brief Sobrecarga del operador de salida (<<) para `uint128_t`.
+ * Permite imprimir valores de 128 bits sin signo en un `std::ostream`.
+ */
+inline std::ostream &operator<<(std::ostream &os, const uint128_t &val) {
+  char buffer[internal::UINT128_MAX_DIGITS];
+  const auto result = to_chars(buffer, buffer + sizeof(buffer), val);
+  return os << std::string_view(
+             buffer, static_cast<std::size_t>(result.ptr - buffer));
+}
+
+/**
+ * @brief Sobrecarga del operador de salida (<<) para `int128_t`.
+ * Permite imprimir valores de 128 bits con signo en un `std::ostream`.
+ */
+inline std::ostream &operator<<(std::ostream &os, const int128_t &val) {
+  char buffer[internal::UINT128_MAX_DIGITS + 1]; // + signo
+  const auto result = to_chars(buffer, buffer + sizeof(buffer), val);
+  return os << std::string_view(
+             buffer, static_cast<std::size_t>(result.ptr - buffer));
+}
+
+namespace internal {
+
+/**
+ * @brief Lee un token del stream y lo convierte con `from_chars`.
+ *
+ * Admite un '+' inicial (como los extractores estándar) y exige consumir
+ * el token entero: "12ab" es un error. Con error, `failbit` y `val` sin
+ * modificar.
+ */
+template <typename T>
+std::istream &extract_int128(std::istream &is, T &val) {
+  std::string s;
+  is >> s; // Leemos la entrada como una cadena
+
+  const char *first = s.data();
+  const char *const last = s.data() + s.size();
+  if (s.size() > 1 && s[0] == '+' && s[1] != '-') { // from_chars no admite '+'
+    ++first;
+  }
+  T parsed = 0;
+  const auto result = from_chars(first, last, parsed);
+  if (result.ec != std::errc{} || result.ptr != last) {
+    is.setstate(std::ios_base::failbit);
+    return is;
+  }
+  val = parsed;
   return is;
 }
 
+} // namespace internal
+
+/**
+ * @brief Sobrecarga del operador de entrada (>>) para `int128_t`.
+ * Permite leer valores de 128 bits con signo desde un `std::istream`.
+ * Maneja overflow y formato inválido estableciendo el `failbit` del stream.
+ */
+inline std::istream &operator>>(std::istream &is, int128_t &val) {
+  return internal::extract_int128(is, val);
+}
+
+/**
+ * @brief Sobrecarga del operador de entrada (>>) para `uint128_t`.
+ * Igual que la versión con signo; un '-' inicial es formato inválido.
+ */
+inline std::istream &operator>>(std::istream &is, uint128_t &val) {
+  return internal::extract_int128(is, val);
+}
+
 #endif // HAS_NATIVE_INT128
 
 } // namespace numbers_calculations::core
@@ -0,0 +1,363 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: batch_ops.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Versiones "por lotes" de las funciones de `combinatorics.hpp` e
+ * `integer_ops.hpp`, que procesan columnas enteras de valores de una vez:
+ *
+ *     factorial_batch, combinations_batch, integer_power_batch,
+ *     integer_log2_batch
+ *
+ * Explicación didáctica:
+ * La API escalar devuelve un `core::Expected<T>` por elemento, lo que
+ * obliga a un salto condicional por llamada e impide al compilador
+ * vectorizar el bucle del usuario. Aquí los errores se devuelven en un
+ * array de estado paralelo (`core::MathError::NoError` si el elemento es
+ * válido) y el valor de retorno es el número de elementos con error, de
+ * modo que el caso habitual ("todo correcto") se comprueba con un único
+ * `if`.
+ *
+ * Para tipos nativos de hasta 64 bits los bucles están escritos sin saltos:
+ * el índice se "sujeta" a un rango válido, el valor se lee de una LUT
+ * (uint64_t) y el estado se calcula con selecciones. Con -O3 y un conjunto
+ * de instrucciones con gather (p. ej. -mavx2) el compilador los convierte en
+ * lecturas vectoriales de la LUT. El resto de tipos (uint128_t, Boost) usan
+ * la función escalar elemento a elemento.
+ *
+ * Todas las funciones tienen la forma
+ *
+ *     std::size_t f_batch(entradas..., count, salida, status)
+ *
+ * donde `salida` y `status` deben tener al menos `count` elementos. En C++20
+ * existen además sobrecargas equivalentes con `std::span`.
+ * ==============================================================================
+ */
+
+#include <array>   // Para las LUTs
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t
+#include <limits>  // Para numeric_limits
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_supported_integer_v y HAS_CPP20_SPAN
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/combinatorics.hpp> // Para factorial y combinations
+#include <numbers_calculations/math/integer_ops.hpp> // Para integer_power e integer_log2
+#include <numbers_calculations/math/internal/binomial_lookup_table.hpp> // Para BINOMIALS_LUT_64
+#include <numbers_calculations/math/internal/factorial_lookup_table.hpp> // Para FACTORIALS_LUT
+
+namespace numbers_calculations::math {
+
+namespace internal {
+
+// Tipos con bucle vectorizable: enteros nativos de hasta 64 bits.
+template <typename T>
+inline constexpr bool is_batch_native_v =
+    std::is_integral_v<T> && sizeof(T) <= sizeof(std::uint64_t);
+
+// 20! es el último factorial que cabe en un uint64_t. Copia de 64 bits de
+// FACTORIALS_LUT para que las lecturas vectoriales usen elementos de 8 bytes,
+// más una entrada centinela a 0 (índice BATCH_FACTORIAL_SENTINEL) que se lee
+// para los elementos con error.
+inline constexpr std::size_t BATCH_FACTORIAL_SENTINEL = 21;
+
+constexpr std::array<std::uint64_t, BATCH_FACTORIAL_SENTINEL + 1>
+generate_batch_factorial_lut() {
+  std::array<std::uint64_t, BATCH_FACTORIAL_SENTINEL + 1> table{};
+  for (std::size_t i = 0; i < BATCH_FACTORIAL_SENTINEL; ++i) {
+    table[i] = static_cast<std::uint64_t>(FACTORIALS_LUT[i]);
+  }
+  return table;
+}
+
+constexpr auto BATCH_FACTORIALS_LUT_64 = generate_batch_factorial_lut();
+
+/**
+ * @brief Mayor n tal que n! cabe en T (T nativo de hasta 64 bits).
+ */
+template <typename T> constexpr std::size_t max_factorial_argument() {
+  std::size_t n = 0;
+  while (n + 1 < BATCH_FACTORIAL_SENTINEL &&
+         BATCH_FACTORIALS_LUT_64[n + 1] <=
+             static_cast<std::uint64_t>(std::numeric_limits<T>::max())) {
+    ++n;
+  }
+  return n;
+}
+
+/**
+ * @brief value < 0, sin avisos de comparación siempre falsa para unsigned.
+ */
+template <typename T> constexpr bool is_negative(T value) noexcept {
+  if constexpr (std::is_signed_v<T>) {
+    return value < 0;
+  } else {
+    return false;
+  }
+}
+
+/**
+ * @brief Guarda el resultado de una llamada escalar en las salidas del lote.
+ * @return 1 si el elemento tiene error, 0 si no.
+ */
+template <typename T, typename R>
+std::size_t store_batch_result(const core::Expected<R> &result, T &out,
+                               core::MathError &status) noexcept {
+  if (result) {
+    out = static_cast<T>(*result);
+    status = core::MathError::NoError;
+    return 0;
+  }
+  out = T{0};
+  status = result.error();
+  return 1;
+}
+
+} // namespace internal
+
+// ==========================================================================
+// API PÚBLICA: versiones por lotes
+// ==========================================================================
+
+/**
+ * @brief Calcula n[i]! para cada i en [0, count).
+ *
+ * @tparam T Tipo entero soportado.
+ * @param n Array de entrada con `count` valores.
+ * @param count Número de elementos.
+ * @param out Array de salida (`out[i] = n[i]!`, o 0 si hay error).
+ * @param status Array de estado (`NoError`, `Overflow` o `DomainError`).
+ * @return El número de elementos con error.
+ *
+ * @test_property factorial_batch(...) coincide elemento a elemento con
+ * factorial(n[i])
+ *
+ * @optimize_note Para tipos nativos de hasta 64 bits el bucle no tiene
+ * saltos: índice sujetado (o centinela) + lectura de la LUT de 64 bits.
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+std::size_t factorial_batch(const T *n, std::size_t count, T *out,
+                            core::MathError *status) noexcept {
+  std::size_t errors = 0;
+
+  if constexpr (internal::is_batch_native_v<T>) {
+    constexpr auto limit = internal::max_factorial_argument<T>();
+    // Copia local: así el compilador sabe que `out` no puede solapar la LUT
+    // y puede usar lecturas vectoriales (gather) sin versionar el bucle.
+    const auto lut = internal::BATCH_FACTORIALS_LUT_64;
+    for (std::size_t i = 0; i < count; ++i) {
+      const T value = n[i];
+      const bool negative = internal::is_negative(value);
+      const bool overflow =
+          !negative && static_cast<std::uint64_t>(value) > limit;
+      const bool error = negative || overflow;
+      const auto index = error ? internal::BATCH_FACTORIAL_SENTINEL
+                               : static_cast<std::size_t>(value);
+      out[i] = static_cast<T>(lut[index]);
+      status[i] = negative   ? core::MathError::DomainError
+                  : overflow ? core::MathError::Overflow
+                             : core::MathError::NoError;
+      errors += error;
+    }
+  } else {
+    for (std::size_t i = 0; i < count; ++i) {
+      errors += internal::store_batch_result(factorial(n[i]), out[i], status[i]);
+    }
+  }
+  return errors;
+}
+
+/**
+ * @brief Calcula C(n[i], k[i]) para cada i en [0, count).
+ *
+ * @tparam T Tipo entero soportado.
+ * @param n, k Arrays de entrada con `count` valores cada uno.
+ * @param count Número de elementos.
+ * @param out Array de salida (`out[i] = C(n[i], k[i])`, o 0 si hay error).
+ * @param status Array de estado (`NoError`, `Overflow` o `DomainError`).
+ * @return El número de elementos con error.
+ *
+ * @test_property combinations_batch(...) coincide elemento a elemento con
+ * combinations(n[i], k[i])
+ *
+ * @optimize_note Para tipos nativos se hace en dos pasadas: una sin saltos
+ * que resuelve con BINOMIALS_LUT_64 todos los pares con n < 68, y otra que
+ * recorre sólo los pares restantes con la función escalar.
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+std::size_t combinations_batch(const T *n, const T *k, std::size_t count,
+                               T *out, core::MathError *status) noexcept {
+  std::size_t errors = 0;
+
+  if constexpr (internal::is_batch_native_v<T>) {
+    constexpr auto &lut = internal::BINOMIALS_LUT_64;
+    constexpr auto rows = lut.rows();
+    constexpr auto max_value =
+        static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+
+    // 1ª pasada: dominio + LUT, sin saltos
+    std::size_t pending = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      const T nv = n[i];
+      const T kv = k[i];
+      const bool domain =
+          internal::is_negative(nv) || internal::is_negative(kv) || kv > nv;
+      const bool in_lut = !domain && static_cast<std::uint64_t>(nv) < rows;
+      const auto row = in_lut ? static_cast<std::size_t>(nv) : std::size_t{0};
+      const auto col = in_lut ? static_cast<std::size_t>(kv) : std::size_t{0};
+      const auto mirrored = col > row / 2 ? row - col : col;
+      const std::uint64_t value = lut.values[lut.offsets[row] + mirrored];
+      const bool overflow = in_lut && value > max_value;
+      const bool ok = in_lut && !overflow;
+      out[i] = ok ? static_cast<T>(value) : T{0};
+      status[i] = domain     ? core::MathError::DomainError
+                  : overflow ? core::MathError::Overflow
+                             : core::MathError::NoError;
+      errors += domain || overflow;
+      pending += !domain && !in_lut;
+    }
+
+    // 2ª pasada: pares fuera de la LUT (n >= 68)
+    for (std::size_t i = 0; pending != 0 && i < count; ++i) {
+      if (status[i] == core::MathError::NoError &&
+          static_cast<std::uint64_t>(n[i]) >= rows) {
+        errors += internal::store_batch_result(combinations(n[i], k[i]),
+                                               out[i], status[i]);
+        --pending;
+      }
+    }
+  } else {
+    for (std::size_t i = 0; i < count; ++i) {
+      errors += internal::store_batch_result(combinations(n[i], k[i]), out[i],
+                                             status[i]);
+    }
+  }
+  return errors;
+}
+
+/**
+ * @brief Calcula base[i] ^ exp[i] para cada i en [0, count).
+ *
+ * @tparam T_Base Tipo entero soportado de las bases.
+ * @tparam T_Exp Tipo entero sin signo de los exponentes.
+ * @param base, exp Arrays de entrada con `count` valores cada uno.
+ * @param count Número de elementos.
+ * @param out Array de salida (`out[i] = base[i]^exp[i]`, o 0 si hay error).
+ * @param status Array de estado (`NoError` u `Overflow`).
+ * @return El número de elementos con error.
+ *
+ * @test_property integer_power_batch(...) coincide elemento a elemento con
+ * integer_power(base[i], exp[i])
+ */
+template <typename T_Base, typename T_Exp,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T_Base> &&
+                  std::is_unsigned_v<T_Exp>,
+              int> = 0>
+std::size_t integer_power_batch(const T_Base *base, const T_Exp *exp,
+                                std::size_t count, T_Base *out,
+                                core::MathError *status) noexcept {
+  std::size_t errors = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    errors += internal::store_batch_result(integer_power(base[i], exp[i]),
+                                           out[i], status[i]);
+  }
+  return errors;
+}
+
+/**
+ * @brief Calcula floor(log2(n[i])) para cada i en [0, count).
+ *
+ * @tparam T Tipo entero sin signo.
+ * @param n Array de entrada con `count` valores.
+ * @param count Número de elementos.
+ * @param out Array de salida (`out[i] = floor(log2(n[i]))`, o 0 si hay error).
+ * @param status Array de estado (`NoError` o `DomainError` si n[i] == 0).
+ * @return El número de elementos con error.
+ *
+ * @test_property integer_log2_batch(...) coincide elemento a elemento con
+ * integer_log2(n[i])
+ *
+ * @optimize_note Para tipos nativos el bucle no tiene saltos: se calcula
+ * log2(n | 1), que vale 0 para n == 0, y el error se marca aparte.
+ */
+template <typename T,
+          std::enable_if_t<numbers_calculations::core::is_unsigned_v<T>, int> =
+              0>
+std::size_t integer_log2_batch(const T *n, std::size_t count,
+                               unsigned int *out,
+                               core::MathError *status) noexcept {
+  std::size_t errors = 0;
+
+  if constexpr (internal::is_batch_native_v<T>) {
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto value = static_cast<std::uint64_t>(n[i]);
+      const bool zero = value == 0;
+      out[i] = *integer_log2(value | 1);
+      status[i] = zero ? core::MathError::DomainError : core::MathError::NoError;
+      errors += zero;
+    }
+  } else {
+    for (std::size_t i = 0; i < count; ++i) {
+      errors += internal::store_batch_result(integer_log2(n[i]), out[i],
+                                             status[i]);
+    }
+  }
+  return errors;
+}
+
+#if HAS_CPP20_SPAN
+// --------------------------------------------------------------------------
+// Sobrecargas con std::span (C++20)
+// Se procesan `n.size()` elementos; `out` y `status` deben ser al menos
+// igual de grandes. Como T no se deduce desde contenedores, se indica
+// explícitamente: factorial_batch<std::uint64_t>(n, out, status).
+// --------------------------------------------------------------------------
+
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+std::size_t factorial_batch(std::span<const T> n, std::span<T> out,
+                            std::span<core::MathError> status) noexcept {
+  return factorial_batch(n.data(), n.size(), out.data(), status.data());
+}
+
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+std::size_t combinations_batch(std::span<const T> n, std::span<const T> k,
+                               std::span<T> out,
+                               std::span<core::MathError> status) noexcept {
+  return combinations_batch(n.data(), k.data(), n.size(), out.data(),
+                            status.data());
+}
+
+template <typename T_Base, typename T_Exp,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T_Base> &&
+                  std::is_unsigned_v<T_Exp>,
+              int> = 0>
+std::size_t integer_power_batch(std::span<const T_Base> base,
+                                std::span<const T_Exp> exp,
+                                std::span<T_Base> out,
+                                std::span<core::MathError> status) noexcept {
+  return integer_power_batch(base.data(), exp.data(), base.size(), out.data(),
+                             status.data());
+}
+
+template <typename T,
+          std::enable_if_t<numbers_calculations::core::is_unsigned_v<T>, int> =
+              0>
+std::size_t integer_log2_batch(std::span<const T> n,
+                               std::span<unsigned int> out,
+                               std::span<core::MathError> status) noexcept {
+  return integer_log2_batch(n.data(), n.size(), out.data(), status.data());
+}
+#endif // HAS_CPP20_SPAN
+
+} // namespace numbers_calculations::math
@@ -0,0 +1,558 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: combinatorial_numbers.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Números combinatorios "especiales" que completan a combinatorics.hpp:
+ *
+ * - multinomial(k1, ..., km) = (k1 + ... + km)! / (k1! * ... * km!)
+ * - catalan(n)               = C(2n, n) / (n + 1)
+ * - stirling_first(n, k)     = ciclos: permutaciones de n con k ciclos
+ *                              (primera especie, sin signo)
+ * - stirling_second(n, k)    = particiones de n elementos en k bloques
+ * - bell(n)                  = particiones de n elementos (suma de S2(n, k))
+ *
+ * Igual que `factorial`, cada función consulta primero una LUT `constexpr`
+ * que llega hasta el límite de uint128_t (ver
+ * internal/combinatorial_numbers_lut.hpp); fuera de ella los tipos nativos
+ * usan bucles con overflow comprobado y los tipos de Boost un camino
+ * específico para enteros grandes.
+ *
+ * Además se ofrecen generadores de filas (`StirlingRows`, `BellTriangleRows`)
+ * que producen la fila n+1 de cada triángulo a partir de la fila n en O(n),
+ * sin recalcular desde cero.
+ *
+ * @todo_feature Números de Stirling de primera especie con signo.
+ * ==============================================================================
+ */
+
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t
+#include <initializer_list>
+#include <iterator> // Para std::iterator_traits
+#include <limits> // Para numeric_limits
+#include <numbers_calculations/core/checked_arith.hpp> // Para checked_mul_add
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_supported_integer_v
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/combinatorics.hpp> // Para combinations, narrow_lut_value y lut_index_below
+#include <numbers_calculations/math/internal/combinatorial_numbers_lut.hpp> // Para CATALANS_LUT, BELLS_LUT...
+#include <numbers_calculations/math/prime_exponents.hpp> // Para binomial_prime_exponents
+#include <utility> // Para std::swap
+#include <vector>
+
+namespace numbers_calculations::math {
+
+// ==========================================================================
+// Generadores incrementales de filas
+// ==========================================================================
+
+/**
+ * @brief Especie de los números de Stirling.
+ */
+enum class StirlingKind {
+  First, // c(n, k): permutaciones de n elementos con k ciclos (sin signo)
+  Second // S(n, k): particiones de n elementos en k bloques
+};
+
+/**
+ * @brief Genera las filas del triángulo de Stirling de una en una.
+ *
+ * La fila n contiene S(n, 0), ..., S(n, n). `next()` construye la fila n+1
+ * con la recurrencia
+ *
+ *     S(n+1, k) = m * S(n, k) + S(n, k-1),   m = n (1ª especie) o k (2ª)
+ *
+ * en O(n) operaciones y sin reservar memoria una vez alcanzado el tamaño.
+ *
+ * @tparam T Tipo entero soportado.
+ * @tparam Kind Especie (StirlingKind::First o StirlingKind::Second).
+ *
+ * @test_property StirlingRows<uint64_t, StirlingKind::Second> tras 4
+ * llamadas a next(): row() == {0, 1, 7, 6, 1}
+ */
+template <typename T, StirlingKind Kind,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+class StirlingRows {
+public:
+  StirlingRows() : row_{T{1}} {}
+
+  // Índice n de la fila actual.
+  std::size_t index() const noexcept { return row_.size() - 1; }
+
+  // Fila actual: row()[k] == S(index(), k).
+  const std::vector<T> &row() const noexcept { return row_; }
+
+  /**
+   * @brief Avanza a la fila siguiente.
+   * @return Vacío si tiene éxito o `MathError::Overflow` si alguna entrada
+   * no cabe en T (en ese caso la fila actual no cambia).
+   */
+  core::Expected<void> next() noexcept {
+    const std::size_t n = index();
+    next_.resize(n + 2);
+    next_[0] = T{0};
+    for (std::size_t k = 1; k <= n + 1; ++k) {
+      const T above = k <= n ? row_[k] : T{0};
+      const T multiplier =
+          Kind == StirlingKind::First ? static_cast<T>(n) : static_cast<T>(k);
+      auto value = core::checked_mul_add(multiplier, above, row_[k - 1]);
+      if (!value) {
+        return core::Unexpected(value.error());
+      }
+      next_[k] = std::move(*value);
+    }
+    std::swap(row_, next_);
+    return {};
+  }
+
+private:
+  std::vector<T> row_;
+  std::vector<T> next_; // Buffer reutilizado entre llamadas
+};
+
+/**
+ * @brief Genera las filas del triángulo de Bell (Aitken) de una en una.
+ *
+ * La fila n empieza en B(n) y termina en B(n+1); cada entrada es la suma
+ * de su vecina izquierda y de la que tiene encima:
+ *
+ *     1
+ *     1  2
+ *     2  3  5
+ *     5  7 10 15
+ *
+ * `next()` construye la fila n+1 en O(n) operaciones.
+ *
+ * @test_property BellTriangleRows<uint64_t> tras 3 llamadas a next():
+ * row() == {5, 7, 10, 15}, bell() == 5
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+class BellTriangleRows {
+public:
+  BellTriangleRows() : row_{T{1}} {}
+
+  // Índice n de la fila actual.
+  std::size_t index() const noexcept { return row_.size() - 1; }
+
+  // Fila actual del triángulo.
+  const std::vector<T> &row() const noexcept { return row_; }
+
+  // B(index()), el primer elemento de la fila actual.
+  const T &bell() const noexcept { return row_.front(); }
+
+  /**
+   * @brief Avanza a la fila siguiente.
+   * @return Vacío si tiene éxito o `MathError::Overflow` si alguna entrada
+   * no cabe en T (en ese caso la fila actual no cambia).
+   */
+  core::Expected<void> next() noexcept {
+    const std::size_t n = index();
+    next_.resize(n + 2);
+    next_[0] = row_[n];
+    for (std::size_t i = 1; i <= n + 1; ++i) {
+      auto value = core::checked_add(next_[i - 1], row_[i - 1]);
+      if (!value) {
+        return core::Unexpected(value.error());
+      }
+      next_[i] = std::move(*value);
+    }
+    std::swap(row_, next_);
+    return {};
+  }
+
+private:
+  std::vector<T> row_;
+  std::vector<T> next_; // Buffer reutilizado entre llamadas
+};
+
+namespace internal {
+
+/**
+ * @brief S(n, k) fuera de la LUT, por programación dinámica sobre la banda
+ * de entradas de las que depende.
+ *
+ * S(n, k) sólo depende de las entradas S(j + t, j) con j <= k y
+ * t <= d = n - k. Se recorre por columnas j = 1..k guardando las d + 1
+ * entradas de la columna, lo que cuesta O(k * d) operaciones y O(d)
+ * memoria. Todas esas entradas son <= S(n, k), así que no hay overflows
+ * intermedios espurios: sólo se reporta overflow si S(n, k) no cabe en T.
+ *
+ * @pre 2 <= k < n - 1.
+ */
+template <typename T>
+core::Expected<T> stirling_band(StirlingKind kind, const T &n,
+                                const T &k) noexcept {
+  const T d = n - k;
+  if constexpr (std::numeric_limits<T>::is_bounded) {
+    // S(n, k) >= 2^d para k >= 2: si d no cabe en los bits de T, desborda
+    if (d >= static_cast<T>(std::numeric_limits<T>::digits)) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+  }
+
+  const auto width = static_cast<std::size_t>(d) + 1;
+  // column[t] = S(j + t, j); columna j = 0: S(t, 0) = [t == 0]
+  std::vector<T> column(width, T{0});
+  column[0] = T{1};
+  for (T j = 1; j <= k; ++j) {
+    column[0] = T{1}; // S(j, j) = 1
+    for (std::size_t t = 1; t < width; ++t) {
+      // S(m, j) = mult * S(m-1, j) + S(m-1, j-1), con m = j + t
+      const T multiplier =
+          kind == StirlingKind::First ? j + static_cast<T>(t) - 1 : j;
+      auto value = core::checked_mul_add(multiplier, column[t - 1], column[t]);
+      if (!value) {
+        return value;
+      }
+      column[t] = std::move(*value);
+    }
+  }
+  return column[width - 1];
+}
+
+/**
+ * @brief Número de Catalan para tipos de Boost fuera de la LUT.
+ *
+ * Factoriza C(2n, n) con el teorema de Kummer, resta los exponentes de
+ * n + 1 (que siempre divide a C(2n, n)) y evalúa el producto con cuadrados
+ * agrupados. Nunca construye C(2n, n), así que no hay overflow espurio.
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> big_catalan(const T &n) noexcept {
+  if (n > std::numeric_limits<std::uint32_t>::max() / 2) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+  const auto m = static_cast<std::uint64_t>(n);
+  auto factors = binomial_prime_exponents(2 * m, m);
+  if (!factors) {
+    return core::Unexpected(factors.error());
+  }
+  std::uint64_t rest = m + 1;
+  for (auto &f : *factors) {
+    while (rest % f.prime == 0) {
+      rest /= f.prime;
+      --f.exponent;
+    }
+    if (rest == 1) {
+      break;
+    }
+  }
+  return evaluate_prime_exponents<T>(*factors);
+}
+
+/**
+ * @brief Número de Bell para tipos de Boost fuera de la LUT: recorre el
+ * triángulo hasta la fila n-1, cuyo último elemento es B(n).
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> big_bell(const T &n) noexcept {
+  BellTriangleRows<T> triangle;
+  while (triangle.index() + 1 < n) {
+    auto step = triangle.next();
+    if (!step) {
+      return core::Unexpected(step.error());
+    }
+  }
+  return triangle.row().back();
+}
+
+/**
+ * @brief Coeficiente multinomial para tipos de Boost a partir de su
+ * factorización: e_p = e_p(s!) - sum_i e_p(k_i!) (fórmula de Legendre).
+ *
+ * @pre s = k_1 + ... + k_m cabe en `std::uint32_t`.
+ */
+template <typename T, typename It,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> big_multinomial(It first, It last, std::uint64_t s) noexcept {
+  auto factors = factorial_prime_exponents(s);
+  if (!factors) {
+    return core::Unexpected(factors.error());
+  }
+  for (auto &f : *factors) {
+    for (It it = first; it != last; ++it) {
+      const auto k = static_cast<std::uint64_t>(*it);
+      for (std::uint64_t q = k / f.prime; q > 0; q /= f.prime) {
+        f.exponent -= q;
+      }
+    }
+  }
+  return evaluate_prime_exponents<T>(*factors);
+}
+
+} // namespace internal
+
+// ==========================================================================
+// API PÚBLICA
+// ==========================================================================
+
+/**
+ * @brief Calcula el coeficiente multinomial (k1 + ... + km)! / (k1! ... km!).
+ *
+ * Se evalúa como producto de binomiales
+ *
+ *     C(k1, k1) * C(k1 + k2, k2) * ... * C(k1 + ... + km, km)
+ *
+ * cuyos productos parciales son multinomiales de los prefijos, todos <= al
+ * resultado: sólo hay overflow si el resultado no cabe en T.
+ *
+ * @tparam It Iterador de entrada sobre un tipo entero soportado.
+ * @param first, last Los valores k_i (deben ser no negativos).
+ * @return Un `core::Expected<T>`:
+ * - .value() con el coeficiente (1 si el rango está vacío).
+ * - .error() (MathError::DomainError) si algún k_i < 0.
+ * - .error() (MathError::Overflow) si el resultado excede el máximo de T.
+ *
+ * @test_property multinomial({2, 3, 4}) == 1260
+ * @test_property multinomial({n, k}) == combinations(n + k, k)
+ *
+ * @optimize_note Para tipos de Boost con suma grande usa la factorización
+ * por la fórmula de Legendre y cuadrados agrupados.
+ */
+template <typename It,
+          typename T = typename std::iterator_traits<It>::value_type,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+core::Expected<T> multinomial(It first, It last) noexcept {
+  T sum{0};
+  for (It it = first; it != last; ++it) {
+    if constexpr (core::is_signed_v<T>) {
+      if (*it < 0) {
+        return core::Unexpected(core::MathError::DomainError);
+      }
+    }
+    // Si la suma no cabe, el resultado (>= suma) tampoco
+    auto next = core::checked_add(sum, static_cast<T>(*it));
+    if (!next) {
+      return next;
+    }
+    sum = std::move(*next);
+  }
+
+  if constexpr (core::is_boost_integer_v<T>) {
+    if (sum >= internal::BINOMIAL_KUMMER_MIN_K &&
+        sum <= std::numeric_limits<std::uint32_t>::max()) {
+      return internal::big_multinomial<T>(first, last,
+                                          static_cast<std::uint64_t>(sum));
+    }
+  }
+
+  T result{1};
+  T prefix{0};
+  for (It it = first; it != last; ++it) {
+    prefix += *it;
+    auto c = combinations(prefix, static_cast<T>(*it));
+    if (!c) {
+      return c;
+    }
+    auto next = core::checked_mul(result, *c);
+    if (!next) {
+      return next;
+    }
+    result = std::move(*next);
+  }
+  return result;
+}
+
+/**
+ * @brief Sobrecarga con lista de inicialización: multinomial({2, 3, 4}).
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+core::Expected<T> multinomial(std::initializer_list<T> ks) noexcept {
+  return multinomial(ks.begin(), ks.end());
+}
+
+/**
+ * @brief Calcula el n-ésimo número de Catalan, C(2n, n) / (n + 1).
+ *
+ * @tparam T Tipo numérico entero.
+ * @param n El índice (debe ser no negativo).
+ * @return Un `core::Expected<T>`:
+ * - .value() si el cálculo es exitoso.
+ * - .error() (MathError::DomainError) si n < 0.
+ * - .error() (MathError::Overflow) si el resultado excede el máximo de T.
+ *
+ * @test_property catalan(10) == 16796
+ * @test_property catalan(37) (para uint64_t) == MathError::Overflow
+ * @test_property catalan(70) (para uint128_t) == MathError::Overflow
+ *
+ * @optimize_note Usa una lookup_table para n < 70.
+ * @optimize_note Para tipos de Boost factoriza C(2n, n) / (n+1) por
+ * exponentes primos (Kummer) en lugar de dividir números grandes.
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+constexpr core::Expected<T> catalan(T n) noexcept {
+  if constexpr (core::is_signed_v<T>) {
+    if (n < 0) {
+      return core::Unexpected(core::MathError::DomainError);
+    }
+  }
+  if (internal::lut_index_below(n, internal::CATALANS_LUT.size())) {
+    return internal::narrow_lut_value<T>(
+        internal::CATALANS_LUT[static_cast<std::size_t>(n)]);
+  }
+  // La LUT llega hasta el límite de uint128_t
+  if constexpr (core::is_boost_integer_v<T>) {
+    if constexpr (std::numeric_limits<T>::is_bounded &&
+                  std::numeric_limits<T>::digits <= 128) {
+      return core::Unexpected(core::MathError::Overflow);
+    } else {
+      return internal::big_catalan(n);
+    }
+  } else {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+}
+
+/**
+ * @brief Calcula el número de Bell B(n): particiones de un conjunto de n
+ * elementos.
+ *
+ * @tparam T Tipo numérico entero.
+ * @param n El tamaño del conjunto (debe ser no negativo).
+ * @return Un `core::Expected<T>`:
+ * - .value() si el cálculo es exitoso.
+ * - .error() (MathError::DomainError) si n < 0.
+ * - .error() (MathError::Overflow) si el resultado excede el máximo de T.
+ *
+ * @test_property bell(10) == 115975
+ * @test_property bell(26) (para uint64_t) == MathError::Overflow
+ * @test_property bell(43) (para uint128_t) == MathError::Overflow
+ *
+ * @optimize_note Usa una lookup_table para n < 43.
+ * @optimize_note Para tipos de Boost recorre el triángulo de Bell con
+ * `BellTriangleRows` hasta la fila n-1, cuyo último elemento es B(n).
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+constexpr core::Expected<T> bell(T n) noexcept {
+  if constexpr (core::is_signed_v<T>) {
+    if (n < 0) {
+      return core::Unexpected(core::MathError::DomainError);
+    }
+  }
+  if (internal::lut_index_below(n, internal::BELLS_LUT.size())) {
+    return internal::narrow_lut_value<T>(
+        internal::BELLS_LUT[static_cast<std::size_t>(n)]);
+  }
+  if constexpr (core::is_boost_integer_v<T>) {
+    if constexpr (std::numeric_limits<T>::is_bounded &&
+                  std::numeric_limits<T>::digits <= 128) {
+      return core::Unexpected(core::MathError::Overflow);
+    } else {
+      return internal::big_bell(n);
+    }
+  } else {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+}
+
+namespace internal {
+
+/**
+ * @brief Implementación común de stirling_first y stirling_second.
+ */
+template <typename T, typename Lut>
+core::Expected<T> stirling(StirlingKind kind, const Lut &lut, T n,
+                           T k) noexcept {
+  if constexpr (core::is_signed_v<T>) {
+    if (n < 0 || k < 0) {
+      return core::Unexpected(core::MathError::DomainError);
+    }
+  }
+  if (k > n) {
+    return T{0};
+  }
+  if (lut_index_below(n, lut.rows())) {
+    return narrow_lut_value<T>(
+        lut(static_cast<std::size_t>(n), static_cast<std::size_t>(k)));
+  }
+
+  // Casos con forma cerrada (n >= filas de la LUT > 1)
+  if (k == 0) {
+    return T{0};
+  }
+  if (k == n) {
+    return T{1};
+  }
+  if (k == n - 1) {
+    return combinations(n, T{2}); // c(n, n-1) = S(n, n-1) = C(n, 2)
+  }
+  if (k == 1) {
+    if (kind == StirlingKind::Second) {
+      return T{1};
+    }
+    return factorial(static_cast<T>(n - 1)); // c(n, 1) = (n-1)!
+  }
+  return stirling_band(kind, n, k);
+}
+
+} // namespace internal
+
+/**
+ * @brief Calcula el número de Stirling de primera especie sin signo c(n, k):
+ * permutaciones de n elementos con exactamente k ciclos.
+ *
+ * @tparam T Tipo numérico entero.
+ * @param n Número de elementos.
+ * @param k Número de ciclos.
+ * @return Un `core::Expected<T>`:
+ * - .value() si el cálculo es exitoso (0 si k > n).
+ * - .error() (MathError::DomainError) si n < 0 o k < 0.
+ * - .error() (MathError::Overflow) si el resultado excede el máximo de T.
+ *
+ * @test_property stirling_first(5, 2) == 50
+ * @test_property stirling_first(n, 1) == factorial(n - 1)
+ *
+ * @optimize_note Usa una lookup_table para n < 35.
+ * @optimize_note Fuera de la LUT recorre sólo la banda de entradas de las
+ * que depende c(n, k) (O(k * (n-k))), sin overflows intermedios espurios.
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+core::Expected<T> stirling_first(T n, T k) noexcept {
+  return internal::stirling(StirlingKind::First, internal::STIRLING_FIRST_LUT,
+                            n, k);
+}
+
+/**
+ * @brief Calcula el número de Stirling de segunda especie S(n, k):
+ * particiones de n elementos en exactamente k bloques no vacíos.
+ *
+ * @tparam T Tipo numérico entero.
+ * @param n Número de elementos.
+ * @param k Número de bloques.
+ * @return Un `core::Expected<T>`:
+ * - .value() si el cálculo es exitoso (0 si k > n).
+ * - .error() (MathError::DomainError) si n < 0 o k < 0.
+ * - .error() (MathError::Overflow) si el resultado excede el máximo de T.
+ *
+ * @test_property stirling_second(5, 2) == 15
+ * @test_property stirling_second(n, 2) == 2^(n-1) - 1
+ *
+ * @optimize_note Usa una lookup_table para n < 44.
+ * @optimize_note Fuera de la LUT recorre sólo la banda de entradas de las
+ * que depende S(n, k) (O(k * (n-k))), sin overflows intermedios espurios.
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+core::Expected<T> stirling_second(T n, T k) noexcept {
+  return internal::stirling(StirlingKind::Second,
+                            internal::STIRLING_SECOND_LUT, n, k);
+}
+
+} // namespace numbers_calculations::math
@@ -0,0 +1,621 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: combinatorial_views.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Enumeración perezosa de combinaciones y permutaciones, con funciones de
+ * rango (rank) y su inversa (unrank):
+ *
+ * - combinations_view(n, k)       -> k-subconjuntos de {0..n-1} como
+ *                                    vectores de índices crecientes.
+ * - combination_masks_view(n, k)  -> los mismos subconjuntos como máscaras
+ *                                    de bits (n <= 64, truco de Gosper).
+ * - permutations_view(n)          -> permutaciones de {0..n-1}.
+ *
+ * Explicación didáctica (orden colexicográfico):
+ * Las combinaciones se recorren en orden colex: se comparan empezando por
+ * el elemento MAYOR. Es exactamente el orden numérico de las máscaras de
+ * bits, así que ambas vistas producen la misma secuencia, y el rango de
+ * {c_0 < c_1 < ... < c_{k-1}} es (sistema numérico combinatorio)
+ *
+ *     rank = C(c_0, 1) + C(c_1, 2) + ... + C(c_{k-1}, k)
+ *
+ * El truco de Gosper calcula la siguiente máscara con el mismo número de
+ * bits en O(1):
+ *
+ *     u = x & -x;  v = x + u;  x' = v + (((v ^ x) / u) >> 2)
+ *
+ * Las permutaciones se recorren en orden lexicográfico y su rango es el
+ * código de Lehmer leído en el sistema factorial.
+ *
+ * Reparto del trabajo:
+ * Todas las vistas aceptan un intervalo de rangos [first, last), de modo que
+ * una enumeración enorme se divide en trozos independientes (uno por hilo)
+ * que empiezan con un `unrank` y continúan con pasos O(1) amortizado.
+ * ==============================================================================
+ */
+
+#include <algorithm> // Para std::next_permutation
+#include <cstddef>   // Para std::size_t, std::ptrdiff_t
+#include <cstdint>   // Para std::uint64_t
+#include <iterator>  // Para std::forward_iterator_tag, std::iterator_traits
+#include <limits>    // Para numeric_limits
+#include <numbers_calculations/core/checked_arith.hpp> // Para add_overflow y checked_mul_add
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/combinatorics.hpp> // Para combinations y factorial
+#include <vector>
+
+namespace numbers_calculations::math {
+
+namespace internal {
+
+/**
+ * @brief C(n, k) en 64 bits, saturado a max(uint64_t) si no cabe
+ * (0 si k > n).
+ */
+inline std::uint64_t saturated_combinations(std::uint64_t n,
+                                            std::uint64_t k) noexcept {
+  if (k > n) {
+    return 0;
+  }
+  const auto c = combinations(n, k);
+  return c ? *c : std::numeric_limits<std::uint64_t>::max();
+}
+
+/**
+ * @brief n! en 64 bits, saturado a max(uint64_t) si no cabe.
+ */
+inline std::uint64_t saturated_factorial(std::uint64_t n) noexcept {
+  const auto f = factorial(n);
+  return f ? *f : std::numeric_limits<std::uint64_t>::max();
+}
+
+/**
+ * @brief Siguiente combinación en orden colex (índices crecientes).
+ *
+ * Se busca el primer índice i que puede avanzar sin chocar con el
+ * siguiente (o con n), se incrementa y los anteriores vuelven a 0..i-1.
+ * Coste O(i + 1), O(1) amortizado sobre toda la enumeración.
+ *
+ * @return false si `c` era la última combinación.
+ */
+inline bool next_combination_colex(std::vector<std::size_t> &c,
+                                   std::size_t n) noexcept {
+  const std::size_t k = c.size();
+  for (std::size_t i = 0; i < k; ++i) {
+    const std::size_t limit = i + 1 < k ? c[i + 1] : n;
+    if (c[i] + 1 < limit) {
+      ++c[i];
+      for (std::size_t j = 0; j < i; ++j) {
+        c[j] = j;
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Siguiente máscara con el mismo número de bits (truco de Gosper).
+ * @pre x != 0 y x no es la última máscara de su tamaño.
+ */
+constexpr std::uint64_t next_combination_mask(std::uint64_t x) noexcept {
+  const std::uint64_t u = x & (~x + 1); // Bit activo más bajo
+  const std::uint64_t v = x + u;        // Propaga el acarreo del bloque bajo
+  return v + (((v ^ x) / u) >> 2);      // Recoloca el resto del bloque abajo
+}
+
+} // namespace internal
+
+// ==========================================================================
+// API PÚBLICA: rank / unrank
+// ==========================================================================
+
+/**
+ * @brief Rango colex de la combinación {c_0 < c_1 < ... < c_{k-1}}.
+ *
+ * @tparam It Iterador de entrada sobre índices (enteros no negativos).
+ * @param first, last Los índices de la combinación, en orden creciente.
+ * @return Un `core::Expected<std::uint64_t>`:
+ * - .value() con sum C(c_i, i+1).
+ * - .error() (MathError::DomainError) si los índices no son estrictamente
+ *   crecientes.
+ * - .error() (MathError::Overflow) si el rango no cabe en 64 bits.
+ *
+ * @test_property combination_rank({0, 1, 2}) == 0
+ * @test_property combination_rank(combination_unrank(r, n, k)) == r
+ */
+template <typename It>
+core::Expected<std::uint64_t> combination_rank(It first, It last) noexcept {
+  std::uint64_t rank = 0;
+  std::uint64_t i = 1;
+  bool has_previous = false;
+  std::uint64_t previous = 0;
+  for (It it = first; it != last; ++it, ++i) {
+    using Value = typename std::iterator_traits<It>::value_type;
+    if constexpr (std::is_signed_v<Value>) {
+      if (*it < 0) {
+        return core::Unexpected(core::MathError::DomainError);
+      }
+    }
+    const auto value = static_cast<std::uint64_t>(*it);
+    if (has_previous && value <= previous) {
+      return core::Unexpected(core::MathError::DomainError);
+    }
+    previous = value;
+    has_previous = true;
+    if (value < i) {
+      continue; // C(c_i, i+1) = 0
+    }
+    const auto term = combinations(value, i);
+    if (!term) {
+      return term;
+    }
+    if (core::add_overflow(rank, *term, rank)) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+  }
+  return rank;
+}
+
+/**
+ * @brief Combinación de rango colex `rank` entre los k-subconjuntos de
+ * {0..n-1}.
+ *
+ * Algoritmo voraz: para i = k..1 se elige el mayor c con C(c, i) <= rank.
+ * Como c sólo decrece, el total es O(n + k) evaluaciones de `combinations`.
+ *
+ * @return Un `core::Expected<std::vector<std::size_t>>`:
+ * - .value() con los índices en orden creciente.
+ * - .error() (MathError::DomainError) si k > n o rank >= C(n, k).
+ *
+ * @test_property combination_unrank(0, n, k) == {0, 1, ..., k-1}
+ */
+inline core::Expected<std::vector<std::size_t>>
+combination_unrank(std::uint64_t rank, std::size_t n, std::size_t k) noexcept {
+  if (k > n || rank >= internal::saturated_combinations(n, k)) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  std::vector<std::size_t> c(k);
+  std::size_t candidate = n;
+  for (std::size_t i = k; i > 0; --i) {
+    // Mayor c < candidato con C(c, i) <= rank (existe: C(i-1, i) = 0)
+    do {
+      --candidate;
+    } while (internal::saturated_combinations(candidate, i) > rank);
+    c[i - 1] = candidate;
+    rank -= internal::saturated_combinations(candidate, i);
+  }
+  return c;
+}
+
+/**
+ * @brief Rango colex de la combinación representada por una máscara.
+ * @return Igual que `combination_rank` sobre los índices de los bits.
+ *
+ * @test_property combination_mask_rank(0b0111) == 0
+ */
+inline core::Expected<std::uint64_t>
+combination_mask_rank(std::uint64_t mask) noexcept {
+  std::uint64_t rank = 0;
+  std::uint64_t i = 1;
+  for (std::uint64_t bit = 0; mask != 0; ++bit, mask >>= 1) {
+    if (mask & 1) {
+      rank += internal::saturated_combinations(bit, i++); // C(63, 32) < 2^64
+    }
+  }
+  return rank;
+}
+
+/**
+ * @brief Máscara de la combinación de rango colex `rank` (n <= 64).
+ * @return La máscara o `MathError::DomainError` si n > 64, k > n o
+ * rank >= C(n, k).
+ */
+inline core::Expected<std::uint64_t>
+combination_mask_unrank(std::uint64_t rank, std::size_t n,
+                        std::size_t k) noexcept {
+  if (n > 64) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  const auto c = combination_unrank(rank, n, k);
+  if (!c) {
+    return core::Unexpected(c.error());
+  }
+  std::uint64_t mask = 0;
+  for (const auto i : *c) {
+    mask |= std::uint64_t{1} << i;
+  }
+  return mask;
+}
+
+/**
+ * @brief Rango lexicográfico de una permutación de {0..n-1}.
+ *
+ * rank = sum d_i * (n-1-i)!, donde d_i es el número de elementos
+ * posteriores a p_i y menores que él (código de Lehmer).
+ *
+ * @return Un `core::Expected<std::uint64_t>`:
+ * - .error() (MathError::DomainError) si la secuencia no es una
+ *   permutación de {0..n-1}.
+ * - .error() (MathError::Overflow) si el rango no cabe en 64 bits.
+ *
+ * @test_property permutation_rank({0, 1, 2}) == 0
+ * @test_property permutation_rank({2, 1, 0}) == 5
+ */
+template <typename It>
+core::Expected<std::uint64_t> permutation_rank(It first, It last) noexcept {
+  const std::vector<std::size_t> p(first, last);
+  const std::size_t n = p.size();
+  std::vector<bool> seen(n, false);
+  for (const auto v : p) {
+    if (v >= n || seen[v]) {
+      return core::Unexpected(core::MathError::DomainError);
+    }
+    seen[v] = true;
+  }
+
+  std::uint64_t rank = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::uint64_t smaller = 0;
+    for (std::size_t j = i + 1; j < n; ++j) {
+      smaller += p[j] < p[i];
+    }
+    if (smaller == 0) {
+      continue;
+    }
+    const auto weight = factorial(static_cast<std::uint64_t>(n - 1 - i));
+    if (!weight) {
+      return weight;
+    }
+    const auto next = core::checked_mul_add(smaller, *weight, rank);
+    if (!next) {
+      return next;
+    }
+    rank = *next;
+  }
+  return rank;
+}
+
+/**
+ * @brief Permutación de {0..n-1} de rango lexicográfico `rank`.
+ * @return La permutación o `MathError::DomainError` si rank >= n!.
+ *
+ * @test_property permutation_unrank(0, n) == {0, 1, ..., n-1}
+ */
+inline core::Expected<std::vector<std::size_t>>
+permutation_unrank(std::uint64_t rank, std::size_t n) noexcept {
+  if (rank >= internal::saturated_factorial(n)) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  std::vector<std::size_t> pool(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    pool[i] = i;
+  }
+  std::vector<std::size_t> p;
+  p.reserve(n);
+  for (std::size_t i = n; i > 0; --i) {
+    // Dígito i-ésimo del sistema factorial (0 si (i-1)! no cabe en 64 bits)
+    const std::uint64_t weight = internal::saturated_factorial(i - 1);
+    const auto digit = static_cast<std::size_t>(rank / weight);
+    rank %= weight;
+    p.push_back(pool[digit]);
+    pool.erase(pool.begin() + static_cast<std::ptrdiff_t>(digit));
+  }
+  return p;
+}
+
+// ==========================================================================
+// API PÚBLICA: vistas (rangos perezosos)
+// ==========================================================================
+
+/**
+ * @brief Vista perezosa de los k-subconjuntos de {0..n-1}, en orden colex,
+ * como vectores de índices crecientes.
+ *
+ * Cada incremento cuesta O(1) amortizado. El iterador expone además
+ * `rank()`, el rango colex del elemento actual.
+ */
+class CombinationsView {
+public:
+  class iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::vector<std::size_t>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    iterator() = default;
+
+    reference operator*() const noexcept { return current_; }
+    pointer operator->() const noexcept { return &current_; }
+    std::uint64_t rank() const noexcept { return position_; }
+
+    iterator &operator++() noexcept {
+      if (++position_ < last_) {
+        internal::next_combination_colex(current_, n_);
+      }
+      return *this;
+    }
+    iterator operator++(int) noexcept {
+      iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    friend bool operator==(const iterator &a, const iterator &b) noexcept {
+      return a.position_ == b.position_;
+    }
+    friend bool operator!=(const iterator &a, const iterator &b) noexcept {
+      return !(a == b);
+    }
+
+  private:
+    friend class CombinationsView;
+    iterator(std::size_t n, std::vector<std::size_t> current,
+             std::uint64_t position, std::uint64_t last)
+        : n_(n), current_(std::move(current)), position_(position),
+          last_(last) {}
+
+    std::size_t n_ = 0;
+    std::vector<std::size_t> current_;
+    std::uint64_t position_ = 0;
+    std::uint64_t last_ = 0;
+  };
+
+  /**
+   * @brief Vista de los rangos [first, last) (recortados a C(n, k)).
+   */
+  CombinationsView(std::size_t n, std::size_t k, std::uint64_t first,
+                   std::uint64_t last) noexcept
+      : n_(n), k_(k) {
+    const std::uint64_t total = internal::saturated_combinations(n, k);
+    last_ = last < total ? last : total;
+    first_ = first < last_ ? first : last_;
+  }
+
+  iterator begin() const {
+    if (first_ == last_) {
+      return end();
+    }
+    return iterator(n_, *combination_unrank(first_, n_, k_), first_, last_);
+  }
+  iterator end() const { return iterator(n_, {}, last_, last_); }
+
+  // Número de combinaciones de la vista.
+  std::uint64_t size() const noexcept { return last_ - first_; }
+  bool empty() const noexcept { return first_ == last_; }
+
+private:
+  std::size_t n_;
+  std::size_t k_;
+  std::uint64_t first_ = 0;
+  std::uint64_t last_ = 0;
+};
+
+/**
+ * @brief Vista perezosa de los k-subconjuntos de {0..n-1} como máscaras de
+ * bits (bit i activo = elemento i elegido), para n <= 64.
+ *
+ * Recorre el mismo orden colex que `CombinationsView` (orden numérico de
+ * las máscaras) con el truco de Gosper: O(1) por elemento.
+ */
+class CombinationMasksView {
+public:
+  class iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::uint64_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = value_type;
+
+    iterator() = default;
+
+    reference operator*() const noexcept { return mask_; }
+    std::uint64_t rank() const noexcept { return position_; }
+
+    iterator &operator++() noexcept {
+      if (++position_ < last_) {
+        mask_ = internal::next_combination_mask(mask_);
+      }
+      return *this;
+    }
+    iterator operator++(int) noexcept {
+      iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    friend bool operator==(const iterator &a, const iterator &b) noexcept {
+      return a.position_ == b.position_;
+    }
+    friend bool operator!=(const iterator &a, const iterator &b) noexcept {
+      return !(a == b);
+    }
+
+  private:
+    friend class CombinationMasksView;
+    iterator(std::uint64_t mask, std::uint64_t position, std::uint64_t last)
+        : mask_(mask), position_(position), last_(last) {}
+
+    std::uint64_t mask_ = 0;
+    std::uint64_t position_ = 0;
+    std::uint64_t last_ = 0;
+  };
+
+  /**
+   * @brief Vista de los rangos [first, last) (recortados a C(n, k)).
+   * Vacía si n > 64.
+   */
+  CombinationMasksView(std::size_t n, std::size_t k, std::uint64_t first,
+                       std::uint64_t last) noexcept
+      : n_(n), k_(k) {
+    const std::uint64_t total =
+        n <= 64 ? internal::saturated_combinations(n, k) : 0;
+    last_ = last < total ? last : total;
+    first_ = first < last_ ? first : last_;
+  }
+
+  iterator begin() const noexcept {
+    if (first_ == last_) {
+      return end();
+    }
+    return iterator(*combination_mask_unrank(first_, n_, k_), first_, last_);
+  }
+  iterator end() const noexcept { return iterator(0, last_, last_); }
+
+  // Número de máscaras de la vista.
+  std::uint64_t size() const noexcept { return last_ - first_; }
+  bool empty() const noexcept { return first_ == last_; }
+
+private:
+  std::size_t n_;
+  std::size_t k_;
+  std::uint64_t first_ = 0;
+  std::uint64_t last_ = 0;
+};
+
+/**
+ * @brief Vista perezosa de las permutaciones de {0..n-1} en orden
+ * lexicográfico. Cada incremento cuesta O(1) amortizado.
+ */
+class PermutationsView {
+public:
+  class iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::vector<std::size_t>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    iterator() = default;
+
+    reference operator*() const noexcept { return current_; }
+    pointer operator->() const noexcept { return &current_; }
+    std::uint64_t rank() const noexcept { return position_; }
+
+    iterator &operator++() noexcept {
+      if (++position_ < last_) {
+        std::next_permutation(current_.begin(), current_.end());
+      }
+      return *this;
+    }
+    iterator operator++(int) noexcept {
+      iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    friend bool operator==(const iterator &a, const iterator &b) noexcept {
+      return a.position_ == b.position_;
+    }
+    friend bool operator!=(const iterator &a, const iterator &b) noexcept {
+      return !(a == b);
+    }
+
+  private:
+    friend class PermutationsView;
+    iterator(std::vector<std::size_t> current, std::uint64_t position,
+             std::uint64_t last)
+        : current_(std::move(current)), position_(position), last_(last) {}
+
+    std::vector<std::size_t> current_;
+    std::uint64_t position_ = 0;
+    std::uint64_t last_ = 0;
+  };
+
+  /**
+   * @brief Vista de los rangos [first, last) (recortados a n!).
+   */
+  PermutationsView(std::size_t n, std::uint64_t first,
+                   std::uint64_t last) noexcept
+      : n_(n) {
+    const std::uint64_t total = internal::saturated_factorial(n);
+    last_ = last < total ? last : total;
+    first_ = first < last_ ? first : last_;
+  }
+
+  iterator begin() const {
+    if (first_ == last_) {
+      return end();
+    }
+    return iterator(*permutation_unrank(first_, n_), first_, last_);
+  }
+  iterator end() const { return iterator({}, last_, last_); }
+
+  // Número de permutaciones de la vista.
+  std::uint64_t size() const noexcept { return last_ - first_; }
+  bool empty() const noexcept { return first_ == last_; }
+
+private:
+  std::size_t n_;
+  std::uint64_t first_ = 0;
+  std::uint64_t last_ = 0;
+};
+
+/**
+ * @brief Todas las combinaciones de k elementos de {0..n-1} (orden colex).
+ *
+ * @test_property combinations_view(4, 2) ==
+ *                {0,1} {0,2} {1,2} {0,3} {1,3} {2,3}
+ */
+inline CombinationsView combinations_view(std::size_t n,
+                                          std::size_t k) noexcept {
+  return {n, k, 0, std::numeric_limits<std::uint64_t>::max()};
+}
+
+/**
+ * @brief Combinaciones de rangos [first, last): un trozo independiente de
+ * la enumeración completa (p. ej. uno por hilo).
+ */
+inline CombinationsView combinations_view(std::size_t n, std::size_t k,
+                                          std::uint64_t first,
+                                          std::uint64_t last) noexcept {
+  return {n, k, first, last};
+}
+
+/**
+ * @brief Todas las combinaciones de k elementos de {0..n-1} como máscaras
+ * (n <= 64; vista vacía en otro caso).
+ *
+ * @test_property combination_masks_view(4, 2) ==
+ *                0b0011 0b0101 0b0110 0b1001 0b1010 0b1100
+ */
+inline CombinationMasksView combination_masks_view(std::size_t n,
+                                                   std::size_t k) noexcept {
+  return {n, k, 0, std::numeric_limits<std::uint64_t>::max()};
+}
+
+/**
+ * @brief Máscaras de rangos [first, last).
+ */
+inline CombinationMasksView
+combination_masks_view(std::size_t n, std::size_t k, std::uint64_t first,
+                       std::uint64_t last) noexcept {
+  return {n, k, first, last};
+}
+
+/**
+ * @brief Todas las permutaciones de {0..n-1} (orden lexicográfico).
+ *
+ * @test_property permutations_view(3) ==
+ *                {0,1,2} {0,2,1} {1,0,2} {1,2,0} {2,0,1} {2,1,0}
+ */
+inline PermutationsView permutations_view(std::size_t n) noexcept {
+  return {n, 0, std::numeric_limits<std::uint64_t>::max()};
+}
+
+/**
+ * @brief Permutaciones de rangos [first, last).
+ */
+inline PermutationsView permutations_view(std::size_t n, std::uint64_t first,
+                                          std::uint64_t last) noexcept {
+  return {n, first, last};
+}
+
+} // namespace numbers_calculations::math
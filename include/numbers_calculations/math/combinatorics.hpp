@@ -7,17 +7,27 @@
  * Objetivo:
  * Implementa funciones matemáticas de combinatoria (factorial, etc.)
  *
- * @todo_feature Implementar combinaciones y permutaciones.
+ * @todo_feature Implementar combinaciones y permutaciones. (¡HECHO!)
+ * @todo_feature Variantes modulares (factorial_mod, combinations_mod...).
+ * (¡HECHO!)
  * @todo_feature Implementar lookup_table para factoriales pequeños (n < 34).
  * (¡HECHO!)
  * ==============================================================================
  */
 
+#include <cstddef> // Para std::size_t
 #include <limits> // Para numeric_limits
+#include <type_traits> // Para std::make_unsigned_t
 #include <numbers_calculations/core/extended_type_traits.hpp> // Para enable_if_t y is_signed_v
+#include <numbers_calculations/core/checked_arith.hpp> // Para checked_mul
 #include <numbers_calculations/core/extended_type_traits.hpp> // Para is_supported_integer_v
 #include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/internal/binomial_lookup_table.hpp> // Para BINOMIALS_LUT_*
 #include <numbers_calculations/math/internal/factorial_lookup_table.hpp> // <-- CORREGIDO: Ruta relativa a internal/
+#include <numbers_calculations/math/internal/modular_factorial_table.hpp> // Para modular_factorial_table
+#include <numbers_calculations/math/internal/prime_swing.hpp> // Para prime_swing_factorial
+#include <numbers_calculations/math/internal/product_tree.hpp> // Para product_range
+#include <numbers_calculations/math/prime_exponents.hpp> // Para factorial_prime_exponents
 
 
 namespace numbers_calculations::math {
@@ -31,18 +41,45 @@ constexpr core::Expected<T> constexpr_factorial(T n) noexcept {
   T i{1};
 
   while (i <= n) {
-    // 2. Comprobación de Overflow
-    // (result * i) > max  <=>  result > (max / i)
-    if (i > 1 && result > (std::numeric_limits<T>::max() / i)) {
+    // Comprobación de Overflow (flag de la multiplicación, sin división)
+    if (core::mul_overflow(result, i, result)) {
       return core::Unexpected(core::MathError::Overflow);
     }
-
-    result *= i;
     ++i;
   }
 
   return result; // Éxito
 }
+
+/**
+ * @brief Convierte un valor de una LUT (uint128_t) al tipo T, comprobando
+ * que cabe en él.
+ */
+template <typename T>
+constexpr core::Expected<T> narrow_lut_value(core::uint128_t value) noexcept {
+  if constexpr (std::numeric_limits<T>::is_bounded &&
+                std::numeric_limits<T>::digits < 128) {
+    if (value > static_cast<core::uint128_t>(std::numeric_limits<T>::max())) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+  }
+  return static_cast<T>(value);
+}
+
+/**
+ * @brief n < size para un índice n >= 0 (ya comprobado) de cualquier tipo.
+ *
+ * Los enteros nativos se pasan a su tipo sin signo (sin -Wsign-compare);
+ * los de 128 bits y Boost se comparan tal cual, sin truncarlos a size_t.
+ */
+template <typename T>
+constexpr bool lut_index_below(const T &n, std::size_t size) noexcept {
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<std::make_unsigned_t<T>>(n) < size;
+  } else {
+    return n < size;
+  }
+}
 } // namespace internal
 
 /**
@@ -69,6 +106,10 @@ constexpr core::Expected<T> constexpr_factorial(T n) noexcept {
  * @test_property factorial(35) (para int128_t) == MathError::Overflow
  *
  * @optimize_note Usa una lookup_table para n < 34.
+ * @optimize_note Para tipos de Boost y n >= 34 usa un árbol de productos
+ * balanceado (binary splitting) en lugar del bucle lineal.
+ * @optimize_note Para tipos de Boost de ancho arbitrario y n grande usa el
+ * algoritmo prime-swing de Luschny (ver internal/prime_swing.hpp).
  */
 template <typename T,
           std::enable_if_t<
@@ -76,7 +117,7 @@ template <typename T,
 constexpr core::Expected<T> factorial(T n) noexcept {
 
   // Para tipos con signo, n < 0 es un error de dominio.
-  if constexpr (std::is_signed_v<T>) {
+  if constexpr (core::is_signed_v<T>) {
     if (n < 0) {
       return core::Unexpected(core::MathError::DomainError);
     }
@@ -86,8 +127,9 @@ constexpr core::Expected<T> factorial(T n) noexcept {
   // debería detectarlo si n es muy grande.
 
   // --- Dispatcher de optimización: Usar LUT si es posible ---
-  if (n < internal::FACTORIALS_LUT.size()) {
-    const auto lut_value = internal::FACTORIALS_LUT[n];
+  if (internal::lut_index_below(n, internal::FACTORIALS_LUT.size())) {
+    const auto lut_value =
+        internal::FACTORIALS_LUT[static_cast<std::size_t>(n)];
 
     // Comprobar si el valor de la LUT cabe en el tipo de retorno T
     if constexpr (std::numeric_limits<T>::is_bounded &&
@@ -100,8 +142,22 @@ constexpr core::Expected<T> factorial(T n) noexcept {
     return static_cast<T>(lut_value);
   }
 
-  // --- Fallback a algoritmo genérico para n >= 34 ---
-  return internal::constexpr_factorial(static_cast<T>(n));
+  // --- Tipos de Boost: árbol de productos (binary splitting) ---
+  if constexpr (core::is_boost_integer_v<T>) {
+    if (n > std::numeric_limits<std::uint64_t>::max()) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+    const auto m = static_cast<std::uint64_t>(n);
+    if constexpr (!std::numeric_limits<T>::is_bounded) {
+      if (m >= internal::PRIME_SWING_THRESHOLD) {
+        return internal::prime_swing_factorial<T>(m);
+      }
+    }
+    return internal::product_range<T>(2, m);
+  } else {
+    // --- Fallback a algoritmo genérico para n >= 34 ---
+    return internal::constexpr_factorial(static_cast<T>(n));
+  }
 }
 
 /**
@@ -113,6 +169,9 @@ constexpr core::Expected<T> factorial(T n) noexcept {
  * @optimize_note Implementado como un bucle `n * (n-1) * ... * (n-k+1)`
  *                para evitar el cálculo de factoriales grandes y prevenir
  *                overflows intermedios.
+ * @optimize_note Para n < 132 y k < 34 usa P(n, k) = C(n, k) * k! con las
+ *                LUTs de binomiales y factoriales (O(1)).
+ * @optimize_note Para tipos de Boost usa el árbol de productos.
  *
  * @tparam T Tipo numérico entero.
  * @param n Número total de elementos.
@@ -126,7 +185,7 @@ template <typename T,
           std::enable_if_t<
               numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
 constexpr core::Expected<T> permutations(T n, T k) noexcept {
-  if constexpr (std::is_signed_v<T>) {
+  if constexpr (core::is_signed_v<T>) {
     if (n < 0 || k < 0) {
       return core::Unexpected(core::MathError::DomainError);
     }
@@ -138,19 +197,125 @@ constexpr core::Expected<T> permutations(T n, T k) noexcept {
     return T{1};
   }
 
-  T result{1};
-  for (T i = 0; i < k; ++i) {
-    T term = n - i;
-    // Comprobación de overflow: result * term > max
-    if (result > std::numeric_limits<T>::max() / term) {
+  // --- Dispatcher de optimización: P(n, k) = C(n, k) * k! desde las LUTs ---
+  if (internal::lut_index_below(n, internal::BINOMIALS_LUT_128.rows()) &&
+      internal::lut_index_below(k, internal::FACTORIALS_LUT.size())) {
+    const auto c = internal::BINOMIALS_LUT_128(static_cast<std::size_t>(n),
+                                               static_cast<std::size_t>(k));
+    const auto f = internal::FACTORIALS_LUT[static_cast<std::size_t>(k)];
+    if (const auto product = core::checked_mul(c, f)) {
+      return internal::narrow_lut_value<T>(*product);
+    }
+    if constexpr (std::numeric_limits<T>::is_bounded &&
+                  std::numeric_limits<T>::digits <= 128) {
       return core::Unexpected(core::MathError::Overflow);
     }
-    result *= term;
   }
 
+  // --- Tipos de Boost: árbol de productos sobre [n-k+1, n] ---
+  if constexpr (core::is_boost_integer_v<T>) {
+    if (n > std::numeric_limits<std::uint64_t>::max()) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+    const auto m = static_cast<std::uint64_t>(n);
+    return internal::product_range<T>(m - static_cast<std::uint64_t>(k) + 1,
+                                      m);
+  } else {
+    T result{1};
+    for (T i = 0; i < k; ++i) {
+      const T term = n - i;
+      if (core::mul_overflow(result, term, result)) {
+        return core::Unexpected(core::MathError::Overflow);
+      }
+    }
+
+    return result;
+  }
+}
+
+namespace internal {
+
+// Umbrales para usar la evaluación exacta por exponentes primos (Kummer) en
+// C(n, k) con tipos de Boost: k suficientemente grande para amortizar la
+// criba, y n no mucho mayor que k para que la criba no domine el coste.
+inline constexpr std::uint64_t BINOMIAL_KUMMER_MIN_K = 64;
+inline constexpr std::uint64_t BINOMIAL_KUMMER_MAX_RATIO = 1024;
+
+/**
+ * @brief C(n, k) para tipos nativos con productos intermedios en un tipo
+ * del doble de ancho (`core::wider_unsigned_t<T>`).
+ *
+ * Se calcula result_i = C(n - k + i, i) = result_{i-1} * (n - k + i) / i,
+ * donde cada división es exacta. Como result_{i-1} <= max(T) y
+ * n - k + i <= max(T), el producto cabe siempre en el tipo ancho, y como
+ * la sucesión es creciente basta comparar cada paso con max(T).
+ *
+ * @pre 0 <= k <= n / 2.
+ */
+template <typename T>
+constexpr core::Expected<T> widened_combinations(T n, T k) noexcept {
+  using W = core::wider_unsigned_t<T>;
+  const W limit = static_cast<W>(std::numeric_limits<T>::max());
+  const W base = static_cast<W>(n - k);
+
+  W result{1};
+  for (T i = 1; i <= k; ++i) {
+    result = result * (base + static_cast<W>(i)) / static_cast<W>(i);
+    if (result > limit) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+  }
+  return static_cast<T>(result);
+}
+
+/**
+ * @brief C(n, k) para tipos de Boost.
+ *
+ * - k grande: factorización exacta por el teorema de Kummer y evaluación
+ *   con cuadrados agrupados (ver prime_exponents.hpp).
+ * - k pequeño: bucle multiplicativo exacto. En tipos acotados se reduce
+ *   antes por gcd(result, i), de modo que el producto nunca supera el
+ *   resultado final y sólo se reporta overflow si C(n, k) no cabe.
+ *
+ * @pre 0 <= k <= n / 2.
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> big_combinations(const T &n, const T &k) noexcept {
+  if (k >= BINOMIAL_KUMMER_MIN_K &&
+      n / k <= BINOMIAL_KUMMER_MAX_RATIO &&
+      n <= std::numeric_limits<std::uint32_t>::max()) {
+    auto factors = binomial_prime_exponents(static_cast<std::uint64_t>(n),
+                                            static_cast<std::uint64_t>(k));
+    if (!factors) {
+      return core::Unexpected(factors.error());
+    }
+    return evaluate_prime_exponents<T>(*factors);
+  }
+
+  T result{1};
+  for (T i = 1; i <= k; ++i) {
+    T term = n - i + 1;
+    if constexpr (std::numeric_limits<T>::is_bounded) {
+      // i divide a result * term: repartimos el divisor entre ambos
+      const T g = boost::multiprecision::gcd(result, i);
+      result /= g;
+      term /= i / g;
+      auto next = core::checked_mul(result, term);
+      if (!next) {
+        return next;
+      }
+      result = std::move(*next);
+    } else {
+      result *= term;
+      result /= i;
+    }
+  }
   return result;
 }
 
+} // namespace internal
+
 /**
  * @brief Calcula el número de combinaciones (C(n, k) = n! / (k! * (n-k)!)).
  *
@@ -160,6 +325,14 @@ constexpr core::Expected<T> permutations(T n, T k) noexcept {
  * @optimize_note Implementado como (n * (n-1) * ... * (n-k+1)) / k!
  *                para evitar el cálculo de factoriales grandes. También usa
  *                la propiedad C(n, k) = C(n, n-k) para minimizar cálculos.
+ * @optimize_note Para n < 132 consulta la LUT triangular de binomiales (O(1)).
+ * @optimize_note Tipos nativos: productos intermedios en un tipo del doble
+ *                de ancho, así que sólo hay overflow si C(n, k) no cabe en T.
+ * @optimize_note Tipos de Boost: evaluación exacta por exponentes primos
+ *                (Kummer) para k grande.
+ *
+ * @test_property combinations(66, 33) (para uint64_t) == 7219428434016265740
+ * @test_property combinations(68, 34) (para uint64_t) == MathError::Overflow
  *
  * @tparam T Tipo numérico entero.
  * @param n Número total de elementos.
@@ -173,7 +346,7 @@ template <typename T,
           std::enable_if_t<
               numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
 constexpr core::Expected<T> combinations(T n, T k) noexcept {
-  if constexpr (std::is_signed_v<T>) {
+  if constexpr (core::is_signed_v<T>) {
     if (n < 0 || k < 0) {
       return core::Unexpected(core::MathError::DomainError);
     }
@@ -191,21 +364,284 @@ constexpr core::Expected<T> combinations(T n, T k) noexcept {
     return T{1};
   }
 
-  // La fórmula es P(n, k) / k!
-  // Lo calculamos de forma iterativa para mantener los números más pequeños
-  // y evitar overflow: (n/1) * ((n-1)/2) * ...
-  T result{1};
-  for (T i = 1; i <= k; ++i) {
-    T term = n - i + 1;
-    // Comprobación de overflow antes de la multiplicación
-    // result * term > max  =>  result > max / term
-    if (result > std::numeric_limits<T>::max() / term) {
+  // --- Dispatcher de optimización: Usar LUT si es posible ---
+  if (internal::lut_index_below(n, internal::BINOMIALS_LUT_128.rows())) {
+    const auto nn = static_cast<std::size_t>(n);
+    const auto kk = static_cast<std::size_t>(k);
+    // La tabla de 64 bits ocupa la cuarta parte y cabe en L1
+    if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(std::uint64_t)) {
+      if (nn < internal::BINOMIALS_LUT_64.rows()) {
+        return internal::narrow_lut_value<T>(internal::BINOMIALS_LUT_64(nn, kk));
+      }
+    }
+    return internal::narrow_lut_value<T>(internal::BINOMIALS_LUT_128(nn, kk));
+  }
+
+  // --- Tipos nativos: producto intermedio en un tipo del doble de ancho ---
+  if constexpr (!std::is_void_v<core::wider_unsigned_t<T>>) {
+    return internal::widened_combinations(n, k);
+  }
+  // --- Tipos de Boost: Kummer para k grande, bucle exacto en otro caso ---
+  else if constexpr (core::is_boost_integer_v<T>) {
+    return internal::big_combinations(n, k);
+  }
+  // --- Fallback (tipos sin tipo más ancho disponible) ---
+  else {
+    // La fórmula es P(n, k) / k!
+    // Lo calculamos de forma iterativa para mantener los números más pequeños
+    // y evitar overflow: (n/1) * ((n-1)/2) * ...
+    T result{1};
+    for (T i = 1; i <= k; ++i) {
+      const T term = n - i + 1;
+      if (core::mul_overflow(result, term, result)) {
+        return core::Unexpected(core::MathError::Overflow);
+      }
+      result /= i;
+    }
+
+    return result;
+  }
+}
+
+// ==========================================================================
+// API PÚBLICA: combinatoria modular (módulo un primo p)
+// ==========================================================================
+
+// Tipos admitidos como módulo: enteros sin signo de 32 y 64 bits.
+template <typename T>
+inline constexpr bool is_modular_word_v =
+    std::is_integral_v<T> && std::is_unsigned_v<T> &&
+    sizeof(T) <= sizeof(std::uint64_t);
+
+namespace internal {
+
+/**
+ * @brief min(x, p - 1 - x): número de factores que recorre x! mod p.
+ */
+template <typename T> constexpr T factorial_mod_span(T x, T p) noexcept {
+  const T m = static_cast<T>(p - 1 - x);
+  return m < x ? m : x;
+}
+
+/**
+ * @brief x! mod p para x < p, con p primo.
+ *
+ * Recorre sólo el menor de x y m = p - 1 - x. Si m es menor, calcula m! y
+ * aplica el teorema de Wilson:  x! = (-1)^(m+1) / m!  (mod p).
+ * Fuera de la tabla cuesta min(x, m) - MOD_TABLE_MAX_SIZE productos; si eso
+ * supera MOD_DIRECT_MAX_STEPS devuelve MathError::Overflow.
+ */
+template <typename T> core::Expected<T> small_factorial_mod(T x, T p) {
+  const T s = factorial_mod_span(x, p);
+  const auto &table = modular_factorial_table(p, s);
+
+  T value; // s!, o su inverso si hay que aplicar Wilson
+  if (s < table.size()) {
+    if (s == x) {
+      return table.fact[s];
+    }
+    value = table.inv_fact[s];
+  } else {
+    if (static_cast<std::uint64_t>(s) - (table.size() - 1) >
+        MOD_DIRECT_MAX_STEPS) {
       return core::Unexpected(core::MathError::Overflow);
     }
-    result *= term;
-    result /= i;
+    value = table.fact.back();
+    for (T i = static_cast<T>(table.size()); i <= s; ++i) {
+      value = mod_mul(value, i, p);
+    }
+    if (s == x) {
+      return value;
+    }
+    value = mod_pow(value, static_cast<std::uint64_t>(p) - 2, p);
+  }
+  // Teorema de Wilson con m = s
+  return (s % 2 == 0 && value != 0) ? static_cast<T>(p - value) : value;
+}
+
+/**
+ * @brief C(n, k) mod p para n < p (un "dígito" del teorema de Lucas).
+ *
+ * Fuera de la tabla cuesta min(k, n - k) productos; si eso supera
+ * MOD_DIRECT_MAX_STEPS devuelve MathError::Overflow.
+ */
+template <typename T>
+core::Expected<T> small_combinations_mod(T n, T k, T p) {
+  if (k > n) {
+    return T{0};
+  }
+  if (k > n - k) {
+    k = n - k;
+  }
+  if (n < MOD_TABLE_MAX_SIZE) {
+    const auto &table = modular_factorial_table(p, n);
+    return mod_mul(mod_mul(table.fact[n], table.inv_fact[k], p),
+                   table.inv_fact[n - k], p);
+  }
+  if (k > MOD_DIRECT_MAX_STEPS) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+  // n (n-1) ... (n-k+1) / k!
+  const auto denominator = small_factorial_mod(k, p);
+  if (!denominator) {
+    return denominator;
+  }
+  T numerator = static_cast<T>(1 % p);
+  for (T i = 0; i < k; ++i) {
+    numerator = mod_mul(numerator, static_cast<T>(n - i), p);
   }
+  return mod_mul(numerator,
+                 mod_pow(*denominator, static_cast<std::uint64_t>(p) - 2, p),
+                 p);
+}
+
+} // namespace internal
 
+/**
+ * @brief Calcula n! mod p, con p primo.
+ *
+ * @tparam T `std::uint32_t` o `std::uint64_t`.
+ * @param n El número.
+ * @param p El módulo (debe ser primo; no se comprueba).
+ * @return Un `core::Expected<T>`:
+ * - .value() con n! mod p.
+ * - .error() (MathError::DomainError) si p < 2.
+ * - .error() (MathError::Overflow) si el cálculo necesita más de
+ *   MOD_DIRECT_MAX_STEPS productos fuera de la tabla.
+ * @throws std::bad_alloc si no se puede reservar la tabla del módulo.
+ *
+ * @test_property factorial_mod(n, p) == 0 si n >= p
+ * @test_property factorial_mod(p - 1, p) == p - 1 (teorema de Wilson)
+ *
+ * @optimize_note Con s = min(n, p - 1 - n), es O(1) si s < MOD_TABLE_MAX_SIZE
+ *                (tras construir la tabla, O(s)) y O(s) en otro caso. Si n
+ *                está cerca de p usa el teorema de Wilson:
+ *                n! = (-1)^(m+1) / m!  (mod p), con m = p - 1 - n.
+ */
+template <typename T, std::enable_if_t<is_modular_word_v<T>, int> = 0>
+core::Expected<T> factorial_mod(T n, T p) {
+  if (p < 2) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  if (n >= p) {
+    return T{0};
+  }
+  return internal::small_factorial_mod(n, p);
+}
+
+/**
+ * @brief Calcula P(n, k) = n! / (n-k)! mod p, con p primo.
+ *
+ * Los k términos n, n-1, ..., n-k+1 contienen un múltiplo de p si y sólo si
+ * k > n mod p; en otro caso P(n, k) = P(n mod p, k) (mod p).
+ *
+ * @tparam T `std::uint32_t` o `std::uint64_t`.
+ * @param n Número total de elementos.
+ * @param k Número de elementos a elegir.
+ * @param p El módulo (debe ser primo; no se comprueba).
+ * @return Un `core::Expected<T>`:
+ * - .value() con P(n, k) mod p.
+ * - .error() (MathError::DomainError) si k > n o p < 2.
+ * - .error() (MathError::Overflow) si el cálculo necesita más de
+ *   MOD_DIRECT_MAX_STEPS productos fuera de la tabla.
+ * @throws std::bad_alloc si no se puede reservar la tabla del módulo.
+ *
+ * @optimize_note Con r = n mod p, es O(1) si r < MOD_TABLE_MAX_SIZE. En otro
+ *                caso cuesta el mínimo entre k productos directos y
+ *                r! / (r-k)! con dos factoriales (ver `factorial_mod`).
+ */
+template <typename T, std::enable_if_t<is_modular_word_v<T>, int> = 0>
+core::Expected<T> permutations_mod(T n, T k, T p) {
+  if (p < 2 || k > n) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  const T r = n % p;
+  if (k > r) {
+    return T{0};
+  }
+
+  if (r < internal::MOD_TABLE_MAX_SIZE) {
+    const auto &table = internal::modular_factorial_table(p, r);
+    return internal::mod_mul(table.fact[r], table.inv_fact[r - k], p);
+  }
+
+  const T q = r - k;
+  const std::uint64_t quotient_steps =
+      static_cast<std::uint64_t>(internal::factorial_mod_span(r, p)) +
+      internal::factorial_mod_span(q, p);
+  if (k <= quotient_steps) {
+    if (k > internal::MOD_DIRECT_MAX_STEPS) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+    T result = static_cast<T>(1 % p);
+    for (T i = 0; i < k; ++i) {
+      result = internal::mod_mul(result, static_cast<T>(r - i), p);
+    }
+    return result;
+  }
+
+  const auto numerator = internal::small_factorial_mod(r, p);
+  if (!numerator) {
+    return numerator;
+  }
+  const auto denominator = internal::small_factorial_mod(q, p);
+  if (!denominator) {
+    return denominator;
+  }
+  return internal::mod_mul(
+      *numerator,
+      internal::mod_pow(*denominator, static_cast<std::uint64_t>(p) - 2, p),
+      p);
+}
+
+/**
+ * @brief Calcula C(n, k) mod p, con p primo.
+ *
+ * Explicación didáctica (teorema de Lucas):
+ * Si n = (n_m ... n_1 n_0)_p y k = (k_m ... k_1 k_0)_p en base p, entonces
+ *
+ *     C(n, k) = C(n_m, k_m) * ... * C(n_1, k_1) * C(n_0, k_0)   (mod p)
+ *
+ * con C(a, b) = 0 si b > a. Cada factor tiene a < p y se obtiene de la
+ * tabla de factoriales e inversos del módulo.
+ *
+ * @tparam T `std::uint32_t` o `std::uint64_t`.
+ * @param n Número total de elementos.
+ * @param k Número de elementos a elegir.
+ * @param p El módulo (debe ser primo; no se comprueba).
+ * @return Un `core::Expected<T>`:
+ * - .value() con C(n, k) mod p.
+ * - .error() (MathError::DomainError) si k > n o p < 2.
+ * - .error() (MathError::Overflow) si un dígito necesita más de
+ *   MOD_DIRECT_MAX_STEPS productos fuera de la tabla.
+ * @throws std::bad_alloc si no se puede reservar la tabla del módulo.
+ *
+ * @test_property combinations_mod(n, k, p) == combinations(n, k) % p
+ *
+ * @optimize_note Cada dígito (n_i, k_i) es O(1) si n_i < MOD_TABLE_MAX_SIZE
+ *                y O(min(k_i, n_i - k_i)) en otro caso.
+ */
+template <typename T, std::enable_if_t<is_modular_word_v<T>, int> = 0>
+core::Expected<T> combinations_mod(T n, T k, T p) {
+  if (p < 2 || k > n) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+
+  T result = static_cast<T>(1 % p);
+  while (k > 0) {
+    const T ni = n % p;
+    const T ki = k % p;
+    if (ki > ni) {
+      return T{0};
+    }
+    const auto digit = internal::small_combinations_mod(ni, ki, p);
+    if (!digit) {
+      return digit;
+    }
+    result = internal::mod_mul(result, *digit, p);
+    n /= p;
+    k /= p;
+  }
   return result;
 }
 
@@ -0,0 +1,622 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: gcd.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Máximo común divisor y funciones derivadas para todos los tipos de
+ * `is_supported_integer_v`:
+ * - `gcd(a, b)`, `lcm(a, b)` (con comprobación de overflow).
+ * - `extended_gcd(a, b)`: coeficientes de Bézout a*x + b*y = gcd(a, b).
+ * - `modular_inverse(a, m)`.
+ * - `gcd_reduce` / `lcm_reduce`: reducciones multihilo sobre rangos.
+ *
+ * Explicación didáctica:
+ * Euclides (a, b) -> (b, a mod b) hace una división por paso, la operación
+ * entera más lenta. Para tipos nativos se usa el algoritmo binario de Stein,
+ * que sólo resta y desplaza:
+ *
+ *     gcd(2^i * a, 2^j * b) = 2^min(i,j) * gcd(a, b)       (a, b impares)
+ *     gcd(a, b) = gcd(|a - b|, min(a, b))                 (|a - b| es par)
+ *
+ * y los ceros finales de |a - b| se quitan de golpe con `ctz` (una
+ * instrucción). Cada vuelta no tiene saltos impredecibles (min y resta
+ * se compilan a `cmov`).
+ *
+ * Para los enteros de Boost cada operación recorre todos los limbs, así que
+ * lo que cuenta es hacer pocas. Lehmer simula Euclides sobre los 62 bits
+ * altos de a y b (aritmética de una palabra) mientras los cocientes sean
+ * seguros, acumulando una matriz 2x2 de cofactores, y sólo entonces la
+ * aplica a los números completos: ~30 pasos de Euclides por cada pasada
+ * sobre los limbs.
+ * ==============================================================================
+ */
+
+#include <atomic>  // Para std::atomic
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t, std::int64_t
+#include <iterator> // Para std::iterator_traits
+#include <limits>  // Para numeric_limits
+#include <numbers_calculations/core/checked_arith.hpp> // Para mul_overflow
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_supported_integer_v y HAS_CPP20_SPAN
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/integer_ops.hpp> // Para trailing_zeros
+#include <numbers_calculations/math/internal/parallel.hpp> // Para parallel_for_chunks
+#include <numbers_calculations/math/parallel_product.hpp> // Para ParallelConfig
+#include <type_traits>
+#include <utility> // Para std::swap
+#include <vector>
+
+namespace numbers_calculations::math {
+
+/**
+ * @brief Tipo de los coeficientes de Bézout de `extended_gcd<T>`.
+ *
+ * Con signo y lo bastante ancho para |x| <= |b| / (2 gcd): el propio T si
+ * tiene signo, su contrapartida con signo si es nativo sin signo y
+ * `cpp_int` para los tipos de Boost sin signo.
+ */
+template <typename T, typename = void> struct bezout_coefficient {
+  using type = T;
+};
+template <typename T>
+struct bezout_coefficient<
+    T, std::enable_if_t<std::is_integral_v<T> && std::is_unsigned_v<T> &&
+                        !std::is_same_v<T, core::uint128_t>>> {
+  using type = std::make_signed_t<T>;
+};
+template <typename T>
+struct bezout_coefficient<T,
+                          std::enable_if_t<std::is_same_v<T, core::uint128_t>>> {
+  using type = core::int128_t;
+};
+template <typename T>
+struct bezout_coefficient<
+    T, std::enable_if_t<core::is_unsigned_v<T> && core::is_boost_integer_v<T>>> {
+  using type = boost::multiprecision::cpp_int;
+};
+template <typename T>
+using bezout_coefficient_t = typename bezout_coefficient<T>::type;
+
+/**
+ * @brief Resultado de `extended_gcd`: a * x + b * y == gcd.
+ */
+template <typename T> struct ExtendedGcd {
+  T gcd;
+  bezout_coefficient_t<T> x;
+  bezout_coefficient_t<T> y;
+};
+
+namespace internal {
+
+// Bits altos que simula cada pasada de Lehmer (cofactores en int64_t).
+inline constexpr unsigned int LEHMER_DIGIT_BITS = 62;
+
+/**
+ * @brief |n| en el tipo sin signo del mismo ancho (válido para el mínimo).
+ */
+template <typename T>
+constexpr typename unsigned_counterpart<T>::type
+native_magnitude(T n) noexcept {
+  using U = typename unsigned_counterpart<T>::type;
+  if constexpr (core::is_signed_v<T>) {
+    if (n < 0) {
+      return static_cast<U>(U{0} - static_cast<U>(n));
+    }
+  }
+  return static_cast<U>(n);
+}
+
+/**
+ * @brief gcd binario (Stein) para enteros nativos sin signo.
+ */
+template <typename U> constexpr U binary_gcd(U a, U b) noexcept {
+  if (a == 0) {
+    return b;
+  }
+  if (b == 0) {
+    return a;
+  }
+  unsigned int a_zeros = trailing_zeros(a);
+  const unsigned int b_zeros = trailing_zeros(b);
+  const unsigned int shift = a_zeros < b_zeros ? a_zeros : b_zeros;
+  b >>= b_zeros;
+  // Invariante: b impar; a se hace impar al principio de cada vuelta
+  while (true) {
+    a >>= a_zeros;
+    const U difference = a < b ? static_cast<U>(b - a) : static_cast<U>(a - b);
+    b = a < b ? a : b;
+    if (difference == 0) {
+      return static_cast<U>(b << shift);
+    }
+    a = difference;
+    a_zeros = trailing_zeros(a);
+  }
+}
+
+/**
+ * @brief Euclides extendido para enteros nativos sin signo.
+ *
+ * Los coeficientes se llevan en aritmética módulo 2^bits(U): los
+ * intermedios pueden desbordar, pero los valores finales cumplen
+ * |x| <= b / (2 g) y |y| <= a / (2 g), así que su interpretación con
+ * signo es exacta.
+ */
+template <typename U>
+constexpr void extended_euclid(U a, U b, U &g, U &x, U &y) noexcept {
+  U old_r = a, r = b;
+  U old_s = 1, s = 0;
+  U old_t = 0, t = 1;
+  while (r != 0) {
+    const U q = old_r / r;
+    U next = static_cast<U>(old_r - q * r);
+    old_r = r;
+    r = next;
+    next = static_cast<U>(old_s - q * s);
+    old_s = s;
+    s = next;
+    next = static_cast<U>(old_t - q * t);
+    old_t = t;
+    t = next;
+  }
+  g = old_r;
+  x = old_s;
+  y = old_t;
+}
+
+/**
+ * @brief gcd de Lehmer sobre cpp_int (a, b >= 0). Si `x` no es nulo,
+ * guarda en él el coeficiente de Bézout de `a` (a * x + b * y == g).
+ */
+inline boost::multiprecision::cpp_int
+lehmer_gcd(boost::multiprecision::cpp_int a, boost::multiprecision::cpp_int b,
+           boost::multiprecision::cpp_int *x = nullptr) {
+  using boost::multiprecision::cpp_int;
+  // s0, s1: coeficientes del `a` original en los `a`, `b` actuales
+  cpp_int s0 = 1;
+  cpp_int s1 = 0;
+  if (a < b) {
+    a.swap(b);
+    s0.swap(s1);
+  }
+  cpp_int next_a, next_b, quotient, remainder;
+  while (b != 0) {
+    // Sin coeficientes y con a en una palabra: Stein nativo
+    if (x == nullptr && boost::multiprecision::msb(a) < 64) {
+      return cpp_int(binary_gcd(static_cast<std::uint64_t>(a),
+                                static_cast<std::uint64_t>(b)));
+    }
+
+    // Dígitos altos (62 bits) de a y b, con el mismo desplazamiento
+    const auto top = static_cast<unsigned int>(boost::multiprecision::msb(a));
+    const unsigned int shift =
+        top >= LEHMER_DIGIT_BITS ? top + 1 - LEHMER_DIGIT_BITS : 0;
+    auto a_digit = static_cast<std::int64_t>(a >> shift);
+    auto b_digit = static_cast<std::int64_t>(b >> shift);
+
+    // Euclides simulado mientras los dos cocientes límite coincidan
+    // (Knuth, TAOCP vol. 2, algoritmo 4.5.2L)
+    std::int64_t A = 1, B = 0, C = 0, D = 1;
+    while (b_digit != 0 && b_digit + C != 0 && b_digit + D != 0) {
+      const std::int64_t q = (a_digit + A) / (b_digit + C);
+      if (q != (a_digit + B) / (b_digit + D)) {
+        break;
+      }
+      std::int64_t t = A - q * C;
+      A = C;
+      C = t;
+      t = B - q * D;
+      B = D;
+      D = t;
+      t = a_digit - q * b_digit;
+      a_digit = b_digit;
+      b_digit = t;
+    }
+
+    if (B == 0) {
+      // Ningún paso seguro: un paso de Euclides completo
+      boost::multiprecision::divide_qr(a, b, quotient, remainder);
+      a.swap(b);
+      b.swap(remainder);
+      if (x != nullptr) {
+        next_a = s0 - quotient * s1;
+        s0.swap(s1);
+        s1.swap(next_a);
+      }
+    } else {
+      // (a, b) <- (A a + B b, C a + D b)
+      next_a = A * a + B * b;
+      next_b = C * a + D * b;
+      a.swap(next_a);
+      b.swap(next_b);
+      if (x != nullptr) {
+        next_a = A * s0 + B * s1;
+        next_b = C * s0 + D * s1;
+        s0.swap(next_a);
+        s1.swap(next_b);
+      }
+    }
+  }
+  if (x != nullptr) {
+    *x = std::move(s0);
+  }
+  return a;
+}
+
+/**
+ * @brief Magnitud de un entero de Boost como cpp_int.
+ */
+template <typename T>
+boost::multiprecision::cpp_int boost_magnitude(const T &n) {
+  return boost::multiprecision::cpp_int(core::internal::boost_abs(n));
+}
+
+/**
+ * @brief Tipo en que se acumulan las reducciones de gcd: los nativos en su
+ * tipo sin signo (donde cabe |min|), los de Boost en el propio T.
+ */
+template <typename T, typename = void> struct gcd_accumulator {
+  using type = T;
+};
+template <typename T>
+struct gcd_accumulator<T, std::enable_if_t<!core::is_boost_integer_v<T>>> {
+  using type = typename unsigned_counterpart<T>::type;
+};
+template <typename T>
+using gcd_accumulator_t = typename gcd_accumulator<T>::type;
+
+/**
+ * @brief gcd(acc, |value|) en el tipo acumulador (nunca falla). `value`
+ * puede ser un elemento (T) u otro acumulado parcial.
+ */
+template <typename T, typename V>
+gcd_accumulator_t<T> gcd_accumulate(const gcd_accumulator_t<T> &acc,
+                                    const V &value) {
+  if constexpr (core::is_boost_integer_v<T>) {
+    return T(lehmer_gcd(boost_magnitude(acc), boost_magnitude(value)));
+  } else {
+    return binary_gcd(acc, native_magnitude(value));
+  }
+}
+
+} // namespace internal
+
+// ==========================================================================
+// API PÚBLICA: gcd, lcm, extended_gcd, modular_inverse
+// ==========================================================================
+
+/**
+ * @brief Calcula el máximo común divisor (siempre >= 0).
+ *
+ * @tparam T Tipo entero (con o sin signo).
+ * @return Un `core::Expected<T>`:
+ * - .value() con gcd(|a|, |b|); gcd(0, 0) == 0.
+ * - .error() (MathError::Overflow) si el resultado no cabe en T (sólo
+ *   gcd(min, 0) y gcd(min, min) con signo).
+ *
+ * @test_property gcd(12, 18) == 6
+ * @test_property gcd(-12, 18) == 6
+ * @test_property gcd(0, 7) == 7
+ * @test_property gcd(a, b) == gcd(b, a)
+ *
+ * @optimize_note Nativos: Stein con `ctz`, sin divisiones. Boost: Lehmer
+ *                (ver cabecera del archivo).
+ */
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+constexpr core::Expected<T> gcd(const T &a, const T &b) noexcept {
+  if constexpr (core::is_boost_integer_v<T>) {
+    return T(internal::lehmer_gcd(internal::boost_magnitude(a),
+                                  internal::boost_magnitude(b)));
+  } else {
+    const auto g = internal::binary_gcd(internal::native_magnitude(a),
+                                        internal::native_magnitude(b));
+    if constexpr (core::is_signed_v<T>) {
+      if (g > static_cast<decltype(g)>(std::numeric_limits<T>::max())) {
+        return core::Unexpected(core::MathError::Overflow);
+      }
+    }
+    return static_cast<T>(g);
+  }
+}
+
+/**
+ * @brief Calcula el mínimo común múltiplo (siempre >= 0).
+ *
+ * @return Un `core::Expected<T>`:
+ * - .value() con lcm(|a|, |b|); lcm(a, 0) == 0.
+ * - .error() (MathError::Overflow) si el resultado no cabe en T.
+ *
+ * @test_property lcm(4, 6) == 12
+ * @test_property lcm(-4, 6) == 12
+ * @test_property lcm(2^32, 2^32 + 1) (uint64_t) == MathError::Overflow
+ *
+ * @optimize_note Se divide antes de multiplicar (|a| / g * |b|), así que
+ *                sólo desborda si el resultado realmente no cabe.
+ */
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+constexpr core::Expected<T> lcm(const T &a, const T &b) noexcept {
+  if (a == 0 || b == 0) {
+    return T{0};
+  }
+  if constexpr (core::is_boost_integer_v<T>) {
+    const T magnitude_a = core::internal::boost_abs(a);
+    const T magnitude_b = core::internal::boost_abs(b);
+    const T g(internal::lehmer_gcd(boost::multiprecision::cpp_int(magnitude_a),
+                                   boost::multiprecision::cpp_int(magnitude_b)));
+    return core::checked_mul(T(magnitude_a / g), magnitude_b);
+  } else {
+    using U = typename internal::unsigned_counterpart<T>::type;
+    const U magnitude_a = internal::native_magnitude(a);
+    const U magnitude_b = internal::native_magnitude(b);
+    U result = magnitude_a / internal::binary_gcd(magnitude_a, magnitude_b);
+    bool overflow = core::mul_overflow(result, magnitude_b, result);
+    if constexpr (core::is_signed_v<T>) {
+      overflow = overflow || result > static_cast<U>(std::numeric_limits<T>::max());
+    }
+    if (overflow) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+    return static_cast<T>(result);
+  }
+}
+
+/**
+ * @brief Algoritmo de Euclides extendido: g = gcd(a, b) y x, y con
+ * a * x + b * y == g.
+ *
+ * Los coeficientes son los mínimos (|x| <= |b| / (2g), |y| <= |a| / (2g)
+ * salvo casos degenerados) y su tipo es `bezout_coefficient_t<T>`.
+ *
+ * @return Un `core::Expected<ExtendedGcd<T>>`, o MathError::Overflow si
+ * gcd(a, b) no cabe en T (ver `gcd`).
+ *
+ * @test_property extended_gcd(240, 46) == {2, -9, 47}
+ * @test_property a * x + b * y == gcd(a, b)
+ */
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+constexpr core::Expected<ExtendedGcd<T>> extended_gcd(const T &a,
+                                                      const T &b) noexcept {
+  using S = bezout_coefficient_t<T>;
+  if constexpr (core::is_boost_integer_v<T>) {
+    using boost::multiprecision::cpp_int;
+    const cpp_int magnitude_a = internal::boost_magnitude(a);
+    const cpp_int magnitude_b = internal::boost_magnitude(b);
+    cpp_int x;
+    const cpp_int g = internal::lehmer_gcd(magnitude_a, magnitude_b, &x);
+    // a x + b y = g  =>  y = (g - a x) / b
+    cpp_int y = magnitude_b != 0 ? cpp_int((g - magnitude_a * x) / magnitude_b)
+                                 : cpp_int(0);
+    if (magnitude_b == 0) {
+      x = magnitude_a != 0 ? 1 : 0;
+    }
+    if (a < 0) {
+      x = -x;
+    }
+    if (b < 0) {
+      y = -y;
+    }
+    return ExtendedGcd<T>{T(g), S(x), S(y)};
+  } else {
+    using U = typename internal::unsigned_counterpart<T>::type;
+    U g = 0, x = 0, y = 0;
+    internal::extended_euclid(internal::native_magnitude(a),
+                              internal::native_magnitude(b), g, x, y);
+    if constexpr (core::is_signed_v<T>) {
+      if (g > static_cast<U>(std::numeric_limits<T>::max())) {
+        return core::Unexpected(core::MathError::Overflow);
+      }
+    }
+    auto signed_x = static_cast<S>(x);
+    auto signed_y = static_cast<S>(y);
+    if constexpr (core::is_signed_v<T>) {
+      if (a < 0) {
+        signed_x = static_cast<S>(-signed_x);
+      }
+      if (b < 0) {
+        signed_y = static_cast<S>(-signed_y);
+      }
+    }
+    return ExtendedGcd<T>{static_cast<T>(g), signed_x, signed_y};
+  }
+}
+
+/**
+ * @brief Calcula el inverso de a módulo m: x en [0, m) con a * x = 1 (mod m).
+ *
+ * @return Un `core::Expected<T>`:
+ * - .value() con el inverso (0 si m == 1).
+ * - .error() (MathError::DomainError) si m <= 0 o gcd(a, m) != 1.
+ *
+ * @test_property modular_inverse(3, 11) == 4
+ * @test_property modular_inverse(-3, 11) == 7
+ * @test_property modular_inverse(6, 9) == MathError::DomainError
+ */
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+constexpr core::Expected<T> modular_inverse(const T &a, const T &m) noexcept {
+  if (m <= 0) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  if constexpr (core::is_boost_integer_v<T>) {
+    using boost::multiprecision::cpp_int;
+    const cpp_int modulus(m);
+    cpp_int residue = cpp_int(a) % modulus;
+    if (residue < 0) {
+      residue += modulus;
+    }
+    cpp_int x;
+    if (internal::lehmer_gcd(residue, modulus, &x) != 1) {
+      return core::Unexpected(core::MathError::DomainError);
+    }
+    x %= modulus;
+    if (x < 0) {
+      x += modulus;
+    }
+    return T(x);
+  } else {
+    using U = typename internal::unsigned_counterpart<T>::type;
+    using S = bezout_coefficient_t<U>;
+    const auto modulus = static_cast<U>(m);
+    U residue = internal::native_magnitude(a) % modulus;
+    if constexpr (core::is_signed_v<T>) {
+      if (a < 0 && residue != 0) {
+        residue = static_cast<U>(modulus - residue);
+      }
+    }
+    U g = 0, x = 0, y = 0;
+    internal::extended_euclid(residue, modulus, g, x, y);
+    if (g != 1) {
+      return core::Unexpected(core::MathError::DomainError);
+    }
+    // |x| < m: si es negativo (como S), se suma m
+    if (static_cast<S>(x) < 0) {
+      x = static_cast<U>(x + modulus);
+    }
+    return static_cast<T>(x);
+  }
+}
+
+// ==========================================================================
+// API PÚBLICA: reducciones multihilo
+// ==========================================================================
+
+/**
+ * @brief gcd de todos los elementos de [first, last), repartido en hilos.
+ *
+ * Cada bloque reduce su tramo por separado y se combinan los parciales.
+ * Como gcd == 1 ya no puede bajar, en cuanto un hilo lo alcanza avisa a
+ * los demás y todos terminan (habitual en normalización de fracciones).
+ *
+ * @tparam It Iterador de acceso aleatorio.
+ * Los parciales se acumulan en el tipo sin signo, así que |min| de un tipo
+ * con signo sólo da error si es el resultado final.
+ *
+ * @return Un `core::Expected<T>` con el gcd (0 si el rango está vacío) o
+ * MathError::Overflow si el gcd final no cabe en T (ver `gcd`).
+ *
+ * @test_property gcd_reduce({12, 18, 30}) == 6
+ */
+template <typename It,
+          typename T = typename std::iterator_traits<It>::value_type,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+core::Expected<T> gcd_reduce(It first, It last,
+                             const ParallelConfig &config = {}) noexcept {
+  const auto count = static_cast<std::size_t>(last - first);
+  const std::size_t chunks = internal::parallel_chunk_count(count, config);
+  using Acc = internal::gcd_accumulator_t<T>;
+  std::vector<Acc> partials(chunks, Acc{0});
+  std::atomic<bool> reached_one{false};
+
+  internal::parallel_for_chunks(chunks, config.thread_count, [&](std::size_t c) {
+    const It begin = first + static_cast<std::ptrdiff_t>(count * c / chunks);
+    const It end = first + static_cast<std::ptrdiff_t>(count * (c + 1) / chunks);
+    Acc acc{0};
+    for (It it = begin; it != end; ++it) {
+      acc = internal::gcd_accumulate<T>(acc, *it);
+      if (acc == 1) {
+        break;
+      }
+      if (reached_one.load(std::memory_order_relaxed)) {
+        break; // Otro bloque ya llegó a 1: el resultado no importa
+      }
+    }
+    if (acc == 1) {
+      reached_one.store(true, std::memory_order_relaxed);
+    }
+    partials[c] = std::move(acc);
+  });
+
+  if (reached_one.load()) {
+    return T{1};
+  }
+  Acc result{0};
+  for (const auto &partial : partials) {
+    result = internal::gcd_accumulate<T>(result, partial);
+  }
+  // Sólo el resultado final puede no caber (|min| con signo)
+  if constexpr (!core::is_boost_integer_v<T> && core::is_signed_v<T>) {
+    if (result > static_cast<Acc>(std::numeric_limits<T>::max())) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+  }
+  return static_cast<T>(result);
+}
+
+/**
+ * @brief lcm de todos los elementos de [first, last), repartido en hilos.
+ *
+ * @return Un `core::Expected<T>`:
+ * - .value() con el lcm (1 si el rango está vacío, 0 si algún elemento
+ *   es 0).
+ * - .error() (MathError::Overflow) si el resultado no cabe en T.
+ *
+ * @test_property lcm_reduce({1, 2, ..., 20}) == 232792560
+ */
+template <typename It,
+          typename T = typename std::iterator_traits<It>::value_type,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+core::Expected<T> lcm_reduce(It first, It last,
+                             const ParallelConfig &config = {}) noexcept {
+  const auto count = static_cast<std::size_t>(last - first);
+  const std::size_t chunks = internal::parallel_chunk_count(count, config);
+  std::vector<core::Expected<T>> partials(chunks, T{1});
+
+  internal::parallel_for_chunks(chunks, config.thread_count, [&](std::size_t c) {
+    const It begin = first + static_cast<std::ptrdiff_t>(count * c / chunks);
+    const It end = first + static_cast<std::ptrdiff_t>(count * (c + 1) / chunks);
+    core::Expected<T> acc = T{1};
+    for (It it = begin; it != end; ++it) {
+      if (*it == 0) {
+        acc = T{0}; // Un 0 gana incluso a un overflow anterior
+        break;
+      }
+      if (acc) {
+        acc = lcm(*acc, *it);
+      }
+    }
+    partials[c] = std::move(acc);
+  });
+
+  for (const auto &partial : partials) {
+    if (partial && *partial == 0) {
+      return T{0};
+    }
+  }
+  core::Expected<T> result = T{1};
+  for (const auto &partial : partials) {
+    if (!partial) {
+      return partial;
+    }
+    result = lcm(*result, *partial);
+    if (!result) {
+      return result;
+    }
+  }
+  return result;
+}
+
+#if HAS_CPP20_SPAN
+// --------------------------------------------------------------------------
+// Sobrecargas con std::span (C++20): gcd_reduce<std::uint64_t>(values)
+// --------------------------------------------------------------------------
+
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+core::Expected<T> gcd_reduce(std::span<const T> values,
+                             const ParallelConfig &config = {}) noexcept {
+  return gcd_reduce(values.begin(), values.end(), config);
+}
+
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+core::Expected<T> lcm_reduce(std::span<const T> values,
+                             const ParallelConfig &config = {}) noexcept {
+  return lcm_reduce(values.begin(), values.end(), config);
+}
+#endif // HAS_CPP20_SPAN
+
+} // namespace numbers_calculations::math
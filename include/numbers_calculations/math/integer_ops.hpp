@@ -11,13 +11,19 @@
  * ==============================================================================
  */
 
-#include "math/internal/lookup_tables.hpp" // <-- CORREGIDO: Ruta relativa a internal/
-#include <array>                           // Para las LUTs
-#include <concepts>                        // Para std::integral (si C++20)
-#include <limits>                          // Para numeric_limits
+#include <array>    // Para las LUTs
+#include <concepts> // Para std::integral (si C++20)
+#include <cstdint>  // Para std::uint64_t
+#include <limits>   // Para numeric_limits
+#include <numbers_calculations/math/internal/addition_chain.hpp> // Para ADDITION_CHAIN
+#include <numbers_calculations/math/internal/log_power_cache.hpp> // Para cached_log_native
+#include <numbers_calculations/math/internal/lookup_tables.hpp> // Para POWERS_OF_*
+#include <utility> // Para std::index_sequence
+#include <numbers_calculations/core/checked_arith.hpp> // Para mul_overflow
 #include <numbers_calculations/core/extended_type_traits.hpp> // Para is_supported_integer_v
 #include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
 #include <stdexcept>                                 // Para std::domain_error
+#include <type_traits> // Para std::is_constant_evaluated
 
 // --- Detección de intrínsecos de compilador para log2 ---
 #if defined(_MSC_VER)
@@ -33,8 +39,21 @@
 #define HAS_CPP20_BITWIDTH
 #endif
 
+// --- Detección de std::is_constant_evaluated (o su intrínseco en C++17) ---
+#if defined(__cpp_lib_is_constant_evaluated)
+#define HAS_IS_CONSTANT_EVALUATED
+#define IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__GNUC__) || defined(__clang__)
+#define HAS_IS_CONSTANT_EVALUATED
+#define IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
 namespace numbers_calculations::math {
 
+// --- Declaración adelantada para integer_log2 ---
+template <typename T, std::enable_if_t<core::is_unsigned_v<T>, int> = 0>
+constexpr core::Expected<unsigned int> integer_log2(T n) noexcept;
+
 namespace internal {
 
 // ======================================================================
@@ -66,27 +85,226 @@ constexpr core::Expected<T_Base> generic_power(T_Base base,
   if (base == 0)
     return T_Base{0};
 
+  if constexpr (core::is_boost_integer_v<T_Base>) {
+    // Tipos de Boost: los productos se escriben en `scratch` y se
+    // intercambian (swap de punteros), reutilizando sus buffers en lugar de
+    // crear un temporario por producto
+    T_Base scratch;
+    while (e > 0) {
+      if (e % 2 == 1) {
+        if (core::mul_overflow(result, b, scratch)) {
+          return core::Unexpected(core::MathError::Overflow);
+        }
+        result.swap(scratch);
+      }
+      if (e > 1) {
+        if (core::mul_overflow(b, b, scratch)) {
+          return core::Unexpected(core::MathError::Overflow);
+        }
+        b.swap(scratch);
+      }
+      e /= 2;
+    }
+    return result;
+  }
+
   while (e > 0) {
     if (e % 2 == 1) { // Si el exponente es impar
-      // Comprobación de overflow: result * b > max
-      if (b != 0 && result > std::numeric_limits<T_Base>::max() / b) {
+      if (core::mul_overflow(result, b, result)) {
         return core::Unexpected(core::MathError::Overflow);
       }
-      result *= b;
     }
 
     if (e > 1) { // Solo si no es la última iteración
-      // Comprobación de overflow: b * b > max
-      if (b != 0 && b > std::numeric_limits<T_Base>::max() / b) {
+      // Elevar la base al cuadrado
+      if (core::mul_overflow(b, b, b)) {
         return core::Unexpected(core::MathError::Overflow);
       }
-      b *= b; // Elevar la base al cuadrado
     }
     e /= 2; // Siguiente dígito del exponente
   }
   return result;
 }
 
+// Tamaño máximo de ventana (2^(k-1) potencias impares precalculadas).
+inline constexpr unsigned SLIDING_WINDOW_MAX_BITS = 6;
+
+/**
+ * @brief Tamaño de ventana k para un exponente de `bits` bits.
+ *
+ * Minimiza (aprox.) bits / (k + 1) productos más 2^(k-1) de precálculo.
+ */
+constexpr unsigned sliding_window_bits(unsigned bits) noexcept {
+  if (bits <= 6) {
+    return 1; // Binario puro: el precálculo no compensa
+  }
+  if (bits <= 24) {
+    return 3;
+  }
+  if (bits <= 80) {
+    return 4;
+  }
+  if (bits <= 240) {
+    return 5;
+  }
+  return SLIDING_WINDOW_MAX_BITS;
+}
+
+/**
+ * @brief base^exp por ventana deslizante de izquierda a derecha (Boost).
+ *
+ * Recorre el exponente desde el bit más alto: los ceros son un cuadrado y
+ * cada ventana de hasta k bits que empieza y acaba en 1 (valor impar w) se
+ * resuelve con tantos cuadrados como bits tiene y un único producto por
+ * base^w, precalculado. Frente al binario (un producto por cada bit a 1)
+ * se ahorra ~20-30% de productos para exponentes de cientos de bits.
+ *
+ * Todos los productos se escriben en un `scratch` que se intercambia con el
+ * resultado, reutilizando los buffers (sin temporarios). Los valores
+ * intermedios (incluidos los precalculados, ya que k < bits) nunca superan
+ * |base|^exp en magnitud, así que un overflow intermedio implica overflow
+ * del resultado.
+ *
+ * @test_property sliding_window_power(b, e) == generic_power(b, e)
+ */
+template <typename T>
+core::Expected<T> sliding_window_power(const T &base,
+                                       std::uint64_t exp) noexcept {
+  if (exp == 0) {
+    return T{1};
+  }
+  const auto bits = static_cast<unsigned>(*integer_log2(exp)) + 1;
+  const unsigned k = sliding_window_bits(bits);
+
+  // odd[i] = base^(2i + 1)
+  std::array<T, std::size_t{1} << (SLIDING_WINDOW_MAX_BITS - 1)> odd;
+  odd[0] = base;
+  T scratch;
+  if (k > 1) {
+    T square;
+    if (core::mul_overflow(base, base, square)) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+    for (std::size_t i = 1; i < (std::size_t{1} << (k - 1)); ++i) {
+      if (core::mul_overflow(odd[i - 1], square, odd[i])) {
+        return core::Unexpected(core::MathError::Overflow);
+      }
+    }
+  }
+
+  T result;
+  bool started = false;
+  int i = static_cast<int>(bits) - 1;
+  while (i >= 0) {
+    if (((exp >> i) & 1) == 0) {
+      if (core::mul_overflow(result, result, scratch)) {
+        return core::Unexpected(core::MathError::Overflow);
+      }
+      result.swap(scratch);
+      --i;
+      continue;
+    }
+    // Ventana [j, i]: como mucho k bits y terminada en 1
+    int j = i - static_cast<int>(k) + 1;
+    if (j < 0) {
+      j = 0;
+    }
+    while (((exp >> j) & 1) == 0) {
+      ++j;
+    }
+    const auto window = static_cast<std::size_t>(
+        (exp >> j) & ((std::uint64_t{1} << (i - j + 1)) - 1));
+    if (!started) {
+      result = odd[window / 2];
+      started = true;
+    } else {
+      for (int s = j; s <= i; ++s) {
+        if (core::mul_overflow(result, result, scratch)) {
+          return core::Unexpected(core::MathError::Overflow);
+        }
+        result.swap(scratch);
+      }
+      if (core::mul_overflow(result, odd[window / 2], scratch)) {
+        return core::Unexpected(core::MathError::Overflow);
+      }
+      result.swap(scratch);
+    }
+    i = j - 1;
+  }
+  return result;
+}
+
+/**
+ * @brief base^exp para tipos de Boost.
+ *
+ * Separa los factores 2 de la base, |base| = impar * 2^t, y calcula
+ *
+ *     base^exp = impar^exp << (t * exp)    (con el signo de base^exp)
+ *
+ * así que las potencias de 2 (y la parte par de 10, 6, 12...) son un único
+ * desplazamiento en lugar de productos de números cada vez más grandes. La
+ * parte impar se eleva por ventana deslizante.
+ */
+template <typename T, typename T_Exp>
+core::Expected<T> big_power(const T &base, T_Exp exp) noexcept {
+  if (exp == 0) {
+    return T{1};
+  }
+  if (base == 0) {
+    return T{0};
+  }
+  bool negative = false;
+  T magnitude = base;
+  if constexpr (core::is_signed_v<T>) {
+    if (base < 0) {
+      negative = exp % 2 == 1;
+      magnitude = -base;
+    }
+  }
+
+  if constexpr (std::numeric_limits<T_Exp>::digits > 64) {
+    if (exp > std::numeric_limits<std::uint64_t>::max()) {
+      // Sólo |base| == 1 tiene una potencia representable
+      if (magnitude == 1) {
+        return generic_power(base, exp);
+      }
+      return core::Unexpected(core::MathError::Overflow);
+    }
+  }
+  const auto e = static_cast<std::uint64_t>(exp);
+
+  const auto t =
+      static_cast<std::uint64_t>(boost::multiprecision::lsb(magnitude));
+  if (t == 0) {
+    return sliding_window_power(base, e);
+  }
+  if (e > std::numeric_limits<std::uint64_t>::max() / t) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+  const std::uint64_t shift = t * e;
+
+  auto odd_power = sliding_window_power(T{magnitude >> t}, e);
+  if (!odd_power) {
+    return odd_power;
+  }
+  if constexpr (std::numeric_limits<T>::is_bounded) {
+    const auto bits =
+        static_cast<std::uint64_t>(boost::multiprecision::msb(*odd_power)) + 1;
+    if (shift >= static_cast<std::uint64_t>(std::numeric_limits<T>::digits) ||
+        bits > static_cast<std::uint64_t>(std::numeric_limits<T>::digits) -
+                   shift) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+  }
+  *odd_power <<= shift;
+  if constexpr (core::is_signed_v<T>) {
+    if (negative) {
+      *odd_power = -*odd_power;
+    }
+  }
+  return odd_power;
+}
+
 /**
  * @brief Implementación genérica de logaritmo (bucle de división).
  * @note Algoritmo O(log_base(n)), usado como fallback.
@@ -106,26 +324,57 @@ constexpr core::Expected<unsigned int> generic_log(T_Base base,
   if (n == 1)
     return 0;
 
+  // base > 1: se convierte una sola vez al tipo de n (sin -Wsign-compare).
+  // Si no cabe en T_Val, n < base y el logaritmo es 0.
+  if constexpr (!core::is_boost_integer_v<T_Val>) {
+    if constexpr (core::is_boost_integer_v<T_Base>) {
+      if (base > std::numeric_limits<T_Val>::max())
+        return 0;
+    } else if (static_cast<core::uint128_t>(base) >
+               static_cast<core::uint128_t>(
+                   std::numeric_limits<T_Val>::max())) {
+      return 0;
+    }
+  }
+  const T_Val divisor = static_cast<T_Val>(base);
+
   unsigned int log = 0;
   T_Val current = n;
 
-  while (current >= base) {
-    current /= base;
+  while (current >= divisor) {
+    current /= divisor;
     log++;
   }
   return log;
 }
 
+/**
+ * @brief Lee base^exp de una LUT de potencias, comprobando que la entrada
+ * existe (0 indica overflow en la tabla) y que cabe en el tipo T.
+ */
+template <typename T, std::size_t N, typename T_Exp>
+constexpr core::Expected<T>
+power_from_lut(const std::array<core::uint128_t, N> &table,
+               T_Exp exp) noexcept {
+  if (exp >= N || table[static_cast<std::size_t>(exp)] == 0) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+  const auto value = table[static_cast<std::size_t>(exp)];
+  if constexpr (std::numeric_limits<T>::is_bounded &&
+                std::numeric_limits<T>::digits < 128) {
+    if (value > static_cast<core::uint128_t>(std::numeric_limits<T>::max())) {
+      return core::Unexpected(core::MathError::Overflow);
+    }
+  }
+  return static_cast<T>(value);
+}
+
 } // namespace internal
 
 // ==========================================================================
 // API PÚBLICA: integer_power
 // ==========================================================================
 
-// --- Declaración adelantada para integer_log2 ---
-template <typename T, std::enable_if_t<std::is_unsigned_v<T>, int> = 0>
-constexpr core::Expected<unsigned int> integer_log2(T n) noexcept;
-
 /**
  * @brief Calcula la potencia entera (base ^ exp).
  *
@@ -133,6 +382,8 @@ constexpr core::Expected<unsigned int> integer_log2(T n) noexcept;
  * (2, 3, 5, 10) para un rendimiento O(1) en tiempo de compilación.
  *
  * Para otras bases, recurre a un algoritmo O(log n) de exponenciación binaria.
+ * Los tipos de Boost no se limitan a las LUTs (128 bits): la parte par de
+ * la base se aplica con un desplazamiento (2^exp es `1 << exp`).
  *
  * @tparam T_Base Tipo entero de la base.
  * @tparam T_Exp Tipo entero sin signo del exponente.
@@ -154,44 +405,92 @@ template <typename T_Base, typename T_Exp,
 constexpr core::Expected<T_Base> integer_power(T_Base base,
                                                T_Exp exp) noexcept {
 
-  // --- Dispatcher de LUTs Constexpr ---
+  // --- Tipos de Boost: LUT si el exponente está en ella; si no,
+  // desplazamientos para la parte par de la base ---
+  if constexpr (core::is_boost_integer_v<T_Base>) {
+    if (base == 3 && exp < internal::POWERS_OF_3.size()) {
+      return internal::power_from_lut<T_Base>(internal::POWERS_OF_3, exp);
+    }
+    if (base == 5 && exp < internal::POWERS_OF_5.size()) {
+      return internal::power_from_lut<T_Base>(internal::POWERS_OF_5, exp);
+    }
+    return internal::big_power(base, exp);
+  }
 
+  // --- Dispatcher de LUTs Constexpr ---
   if (base == 2) {
-    if (exp < internal::POWERS_OF_2.size()) {
-      return static_cast<T_Base>(internal::POWERS_OF_2[exp]);
-    }
-    return core::Unexpected(core::MathError::Overflow);
+    return internal::power_from_lut<T_Base>(internal::POWERS_OF_2, exp);
   }
   if (base == 3) {
-    if (exp < internal::POWERS_OF_3.size()) {
-      // Comprobamos si el valor 0 es por overflow o es 3^0
-      if (internal::POWERS_OF_3[exp] == 0 && exp != 0)
-        return core::Unexpected(core::MathError::Overflow);
-      return static_cast<T_Base>(internal::POWERS_OF_3[exp]);
-    }
-    return core::Unexpected(core::MathError::Overflow);
+    return internal::power_from_lut<T_Base>(internal::POWERS_OF_3, exp);
   }
   if (base == 5) {
-    if (exp < internal::POWERS_OF_5.size()) {
-      if (internal::POWERS_OF_5[exp] == 0 && exp != 0)
-        return core::Unexpected(core::MathError::Overflow);
-      return static_cast<T_Base>(internal::POWERS_OF_5[exp]);
-    }
-    return core::Unexpected(core::MathError::Overflow);
+    return internal::power_from_lut<T_Base>(internal::POWERS_OF_5, exp);
   }
   if (base == 10) {
-    if (exp < internal::POWERS_OF_10.size()) {
-      if (internal::POWERS_OF_10[exp] == 0 && exp != 0)
-        return core::Unexpected(core::MathError::Overflow);
-      return static_cast<T_Base>(internal::POWERS_OF_10[exp]);
-    }
-    return core::Unexpected(core::MathError::Overflow);
+    return internal::power_from_lut<T_Base>(internal::POWERS_OF_10, exp);
   }
 
   // --- Fallback a algoritmo genérico O(log n) ---
   return internal::generic_power(base, exp);
 }
 
+namespace internal {
+
+/**
+ * @brief Evalúa base^Exp recorriendo la cadena de adición, desenrollada en
+ * tiempo de compilación (un producto por paso, sin bucles ni saltos).
+ */
+template <std::uint64_t Exp, typename T, std::size_t... I>
+constexpr core::Expected<T> power_by_chain(const T &base,
+                                           std::index_sequence<I...>) noexcept {
+  constexpr const AdditionChain &chain = ADDITION_CHAIN<Exp>;
+  std::array<T, sizeof...(I) + 1> powers{};
+  powers[0] = base;
+  bool overflow = false;
+  ((overflow |= core::mul_overflow(powers[chain.lhs[I]], powers[chain.rhs[I]],
+                                   powers[I + 1])),
+   ...);
+  if (overflow) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+  return powers[sizeof...(I)];
+}
+
+} // namespace internal
+
+/**
+ * @brief Calcula base^Exp con el exponente fijado en tiempo de compilación.
+ *
+ * Genera en tiempo de compilación una cadena de adición óptima (Exp <= 128)
+ * o binaria (Exp mayor) y la desenrolla: x^15 son 5 productos
+ * (1 2 3 5 10 15) en lugar de 6, sin bucle ni consultas a las LUTs. Las
+ * comprobaciones de overflow se acumulan en un único flag que se consulta
+ * al final.
+ *
+ * @tparam Exp El exponente.
+ * @tparam T_Base Tipo entero de la base.
+ * @param base La base.
+ * @return Un `core::Expected<T_Base>` con el resultado o `MathError::Overflow`.
+ *
+ * @test_property integer_power<2>(x) == x * x
+ * @test_property integer_power<7>(3) == 2187
+ * @test_property integer_power<Exp>(b) == integer_power(b, Exp)
+ * @test_property integer_power<64>(2ULL) == MathError::Overflow
+ */
+template <std::uint64_t Exp, typename T_Base,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T_Base>,
+              int> = 0>
+constexpr core::Expected<T_Base> integer_power(const T_Base &base) noexcept {
+  if constexpr (Exp == 0) {
+    return T_Base{1};
+  } else {
+    return internal::power_by_chain<Exp>(
+        base, std::make_index_sequence<internal::ADDITION_CHAIN<Exp>.length>{});
+  }
+}
+
 // ==========================================================================
 // API PÚBLICA: integer_log (Logaritmos)
 // ==========================================================================
@@ -214,71 +513,134 @@ constexpr core::Expected<T_Base> integer_power(T_Base base,
  * @test_property integer_log2(1024) == 10
  * @test_property integer_log2(0) == MathError::DomainError
  */
-template <typename T, std::enable_if_t<core::is_unsigned_v<T>, int> = 0>
+template <typename T, std::enable_if_t<core::is_unsigned_v<T>, int>>
 constexpr core::Expected<unsigned int> integer_log2(T n) noexcept {
   if (n == 0) {
     return core::Unexpected(core::MathError::DomainError);
   }
 
-#ifdef HAS_CPP20_BITWIDTH
-  // C++20: El método más rápido y portable
-  return std::bit_width(n) - 1;
-#else
-  // C++17: Usamos intrínsecos de compilador
-
-  // Para __uint128_t (que no es un tipo nativo para los intrínsecos)
-  if constexpr (std::is_same_v<T, uint128_t>) {
-    // Dividimos en dos partes de 64 bits
-    uint64_t high = static_cast<uint64_t>(n >> 64);
+  // Para uint128_t (que no es un tipo nativo para los intrínsecos ni para
+  // std::bit_width en modo estricto) dividimos en dos partes de 64 bits
+  if constexpr (std::is_same_v<T, core::uint128_t>) {
+    const auto high = static_cast<std::uint64_t>(n >> 64);
     if (high != 0) {
-      // El bit está en la parte alta
-#if defined(HAS_INTRINSIC_BUILTIN_CLZ)
-      return (127 - __builtin_clzll(high));
-#elif defined(HAS_INTRINSIC_BITSCAN)
-      unsigned long index;
-      _BitScanReverse64(&index, high);
-      return index + 64;
-#else
-      return internal::generic_log(2, n).value(); // Fallback
-#endif
+      return 64 + *integer_log2(high); // El bit está en la parte alta
     }
-    // El bit está en la parte baja
-    uint64_t low = static_cast<uint64_t>(n);
-#if defined(HAS_INTRINSIC_BUILTIN_CLZ)
-    return (63 - __builtin_clzll(low));
+    return integer_log2(static_cast<std::uint64_t>(n));
+  }
+  // Para tipos nativos (uint64_t, uint32_t)
+  else if constexpr (std::is_integral_v<T>) {
+#ifdef HAS_CPP20_BITWIDTH
+    // C++20: El método más rápido y portable
+    return static_cast<unsigned int>(std::bit_width(n) - 1);
+#elif defined(HAS_INTRINSIC_BUILTIN_CLZ)
+    // C++17: Usamos intrínsecos de compilador
+    const auto val = static_cast<unsigned long long>(n);
+    return ((sizeof(unsigned long long) * 8 - 1) - __builtin_clzll(val));
 #elif defined(HAS_INTRINSIC_BITSCAN)
     unsigned long index;
-    _BitScanReverse64(&index, low);
+    _BitScanReverse64(&index, static_cast<unsigned long long>(n));
     return index;
 #else
-    return internal::generic_log(2, n).value(); // Fallback
+    return internal::generic_log(2, n); // Fallback
 #endif
+  } else {
+    // Tipos de Boost: msb inspecciona directamente el limb más alto
+    return static_cast<unsigned int>(boost::multiprecision::msb(n));
   }
-  // Para tipos nativos (uint64_t, uint32_t)
-  else if constexpr (sizeof(T) <= sizeof(unsigned long long)) {
-    unsigned long long val = static_cast<unsigned long long>(n);
-#if defined(HAS_INTRINSIC_BUILTIN_CLZ)
-    return ((sizeof(unsigned long long) * 8 - 1) - __builtin_clzll(val));
+}
+
+namespace internal {
+
+/**
+ * @brief Tipo sin signo del mismo ancho (también para __int128 en modo
+ * estricto, donde std::make_unsigned no lo admite).
+ */
+template <typename T, typename = void> struct unsigned_counterpart {
+  using type = std::make_unsigned_t<T>;
+};
+template <typename T>
+struct unsigned_counterpart<T, std::enable_if_t<core::is_native_int128_v<T>>> {
+  using type = core::uint128_t;
+};
+
+/**
+ * @brief Número de ceros finales de n != 0.
+ */
+template <typename U>
+constexpr unsigned int trailing_zeros(const U &n) noexcept {
+  if constexpr (core::is_boost_integer_v<U>) {
+    return static_cast<unsigned int>(boost::multiprecision::lsb(n));
+  } else if constexpr (std::is_same_v<U, core::uint128_t>) {
+    const auto low = static_cast<std::uint64_t>(n);
+    return low != 0
+               ? trailing_zeros(low)
+               : 64 + trailing_zeros(static_cast<std::uint64_t>(n >> 64));
+  } else {
+#ifdef HAS_CPP20_BITWIDTH
+    return static_cast<unsigned int>(std::countr_zero(n));
+#elif defined(HAS_INTRINSIC_BUILTIN_CLZ)
+    return static_cast<unsigned int>(
+        __builtin_ctzll(static_cast<unsigned long long>(n)));
 #elif defined(HAS_INTRINSIC_BITSCAN)
     unsigned long index;
-    _BitScanReverse64(&index, val);
+    _BitScanForward64(&index, static_cast<unsigned long long>(n));
     return index;
 #else
-    return internal::generic_log(2, n).value(); // Fallback
+    unsigned int count = 0;
+    for (U value = n; (value & 1) == 0; value >>= 1) {
+      ++count;
+    }
+    return count;
 #endif
-  } else {
-    // Fallback para tipos de Boost (cpp_int, etc.)
-    return internal::generic_log(2, n);
   }
-#endif // HAS_CPP20_BITWIDTH
 }
 
+/**
+ * @brief Número de bits a 1 de una palabra de 64 bits.
+ */
+constexpr unsigned int popcount(std::uint64_t n) noexcept {
+#ifdef HAS_CPP20_BITWIDTH
+  return static_cast<unsigned int>(std::popcount(n));
+#elif defined(HAS_INTRINSIC_BUILTIN_CLZ)
+  return static_cast<unsigned int>(
+      __builtin_popcountll(static_cast<unsigned long long>(n)));
+#else
+  unsigned int count = 0;
+  for (; n != 0; n &= n - 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+/**
+ * @brief floor(log10(n)) para n > 0 sin signo, en O(1).
+ *
+ * Anchura en bits (bit-scan) -> estimación por tabla -> una corrección
+ * contra la tabla de potencias de 10 del propio tipo U.
+ */
+template <typename U>
+constexpr unsigned int log10_from_bit_width(U n) noexcept {
+  const unsigned int width = *integer_log2(n) + 1;
+  const unsigned int guess = LOG10_GUESS_BY_BIT_WIDTH[width];
+  return guess - (n < POWERS_OF_10_FOR<U>[guess] ? 1u : 0u);
+}
+
+} // namespace internal
+
 /**
  * @brief [OPTIMIZADO] Calcula el logaritmo entero base 10 (floor(log10(n))).
  *
- * Utiliza una búsqueda binaria `constexpr` sobre la LUT de `POWERS_OF_10`.
+ * Para tipos nativos (hasta 128 bits) es O(1): la anchura en bits de n
+ * (`integer_log2`) indexa una tabla con la estimación de log10, que se
+ * corrige con una única comparación contra una potencia de 10 del tipo del
+ * argumento. Sin bucles ni comparaciones de 128 bits para tipos pequeños.
+ *
+ * Los tipos de Boost estiman con `msb` y comparan con una potencia de 10
+ * de la escalera de cuadrados cacheada (ver `log_power_cache.hpp`).
  *
- * @tparam T Tipo entero (idealmente sin signo).
+ * @tparam T Tipo entero (con o sin signo).
  * @param n El número (debe ser > 0).
  * @return Un `core::Expected<unsigned int>` con el resultado o
  * `MathError::DomainError`.
@@ -298,37 +660,114 @@ constexpr core::Expected<unsigned int> integer_log10(T n) noexcept {
     return core::Unexpected(core::MathError::DomainError);
   }
 
-  // Búsqueda binaria sobre la LUT de POWERS_OF_10
-  // (std::lower_bound en C++20 es constexpr, pero
-  // escribimos un bucle simple para C++17)
-  unsigned int low = 0;
-  unsigned int high = internal::POWERS_OF_10.size() - 1;
-  unsigned int log = 0;
+  if constexpr (core::is_boost_integer_v<T>) {
+#if defined(HAS_IS_CONSTANT_EVALUATED)
+    // Estimación por msb y una comparación con una potencia de 10
+    if (!IS_CONSTANT_EVALUATED()) {
+      return internal::cached_log_big(10, n);
+    }
+#endif
+    return internal::generic_log(T{10}, n);
+  } else {
+    using U = typename internal::unsigned_counterpart<T>::type;
+    return internal::log10_from_bit_width(static_cast<U>(n));
+  }
+}
 
-  while (low <= high) {
-    unsigned int mid = low + (high - low) / 2;
-    if (internal::POWERS_OF_10[mid] == 0) { // Overflow en la tabla
-      high = mid - 1;
-      continue;
+/**
+ * @brief Número de cifras decimales de n (sin contar el signo).
+ *
+ * Es `integer_log10(|n|) + 1`, con decimal_digits(0) == 1. Pensado para
+ * reservar buffers de formateo y agrupar valores por magnitud.
+ *
+ * @tparam T Tipo entero (con o sin signo).
+ * @param n El número.
+ * @return El número de cifras de |n|.
+ *
+ * @test_property decimal_digits(0) == 1
+ * @test_property decimal_digits(99) == 2
+ * @test_property decimal_digits(-100) == 3
+ * @test_property decimal_digits(UINT64_MAX) == 20
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+constexpr unsigned int decimal_digits(const T &n) noexcept {
+  if (n == 0) {
+    return 1;
+  }
+  if constexpr (core::is_boost_integer_v<T>) {
+    if constexpr (core::is_signed_v<T>) {
+      if (n < 0) {
+        return *integer_log10(T{-n}) + 1;
+      }
     }
+    return *integer_log10(n) + 1;
+  } else {
+    using U = typename internal::unsigned_counterpart<T>::type;
+    // |n| en aritmética sin signo (válido también para el mínimo)
+    U magnitude = static_cast<U>(n);
+    if constexpr (core::is_signed_v<T>) {
+      if (n < 0) {
+        magnitude = U{0} - magnitude;
+      }
+    }
+    return internal::log10_from_bit_width(magnitude) + 1;
+  }
+}
 
-    if (static_cast<uint128_t>(n) >= internal::POWERS_OF_10[mid]) {
-      log = mid; // Este es un candidato válido
-      low = mid + 1;
-    } else {
-      high = mid - 1;
+namespace internal {
+
+/**
+ * @brief La base como uint64_t, o 0 si no cabe (base > 1).
+ */
+template <typename T>
+constexpr std::uint64_t log_base_as_u64(const T &base) noexcept {
+  if constexpr (std::numeric_limits<T>::is_bounded &&
+                std::numeric_limits<T>::digits <= 64) {
+    return static_cast<std::uint64_t>(base);
+  } else {
+    if (base > std::numeric_limits<std::uint64_t>::max()) {
+      return 0;
     }
+    return static_cast<std::uint64_t>(base);
   }
-  return log;
 }
 
+/**
+ * @brief log_base(n) por estimación + caché de potencias (ver
+ * `log_power_cache.hpp`). Devuelve false si no aplica (base >= 2^64).
+ */
+template <typename T_Base, typename T_Val>
+bool try_cached_log(const T_Base &base, const T_Val &n,
+                    unsigned int &log) noexcept {
+  const std::uint64_t b = log_base_as_u64(base);
+  if (b == 0) {
+    return false;
+  }
+  if constexpr (core::is_boost_integer_v<T_Val>) {
+    log = cached_log_big(b, n);
+  } else {
+    using U = typename unsigned_counterpart<T_Val>::type;
+    const auto value = static_cast<core::uint128_t>(static_cast<U>(n));
+    log = cached_log_native(b, value, *integer_log2(value) + 1);
+  }
+  return true;
+}
+
+} // namespace internal
+
 /**
  * @brief Calcula el logaritmo entero (floor(log_base(n))).
  *
  * Es `constexpr` y un dispatcher:
  * - Si base == 2, usa la optimización de bit-scan (O(1)).
- * - Si base == 10, usa la optimización de búsqueda binaria (O(log n)).
- * - Para otras bases, recurre a un bucle de división genérico (O(log n)).
+ * - Si base == 10, usa la estimación por anchura en bits (O(1)).
+ * - Para otras bases (< 2^64), estima con la anchura en bits de n por un
+ *   recíproco de log2(base) y corrige con una comparación contra una tabla
+ *   de potencias de la base, guardada en una caché por hilo (O(1) una vez
+ *   construida la tabla). En evaluación constante, o sin forma de
+ *   detectarla, recurre al bucle de división genérico (O(log n)).
  *
  * @tparam T_Base Tipo entero de la base.
  * @tparam T_Val Tipo entero del número.
@@ -353,16 +792,30 @@ constexpr core::Expected<unsigned int> integer_log(T_Base base,
   // --- Dispatcher de optimizaciones ---
   if (base == 2) {
     // Asegurarnos de que n es sin signo para integer_log2
-    if constexpr (std::is_signed_v<T_Val>) {
+    if constexpr (core::is_unsigned_v<T_Val>) {
+      return integer_log2(n);
+    } else if constexpr (core::is_native_int128_v<T_Val>) {
+      return integer_log2(static_cast<core::uint128_t>(n));
+    } else if constexpr (std::is_integral_v<T_Val>) {
       return integer_log2(static_cast<std::make_unsigned_t<T_Val>>(n));
     } else {
-      return integer_log2(n);
+      // Boost con signo (cpp_int): n > 0, msb directamente
+      return static_cast<unsigned int>(boost::multiprecision::msb(n));
     }
   }
   if (base == 10) {
     return integer_log10(n);
   }
 
+#if defined(HAS_IS_CONSTANT_EVALUATED)
+  if (!IS_CONSTANT_EVALUATED()) {
+    unsigned int log = 0;
+    if (internal::try_cached_log(base, n, log)) {
+      return log;
+    }
+  }
+#endif
+
   // --- Fallback a algoritmo genérico ---
   return internal::generic_log(base, n);
 }
@@ -0,0 +1,417 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: integer_roots.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Raíces enteras exactas (floor(n^(1/k))) y detección de potencias
+ * perfectas, para todos los tipos de `is_supported_integer_v`:
+ * - `integer_sqrt(n)`, `integer_cbrt(n)`, `integer_nth_root(n, k)`.
+ * - `is_perfect_power(n)`.
+ *
+ * Explicación didáctica:
+ * Un `double` da 53 bits correctos: por debajo de 2^53 `std::sqrt` es un
+ * punto de partida excelente, pero por encima (uint64_t cerca del máximo,
+ * uint128_t) el redondeo puede dejar la raíz desviada en una o en miles de
+ * unidades. Por eso la semilla de coma flotante se corrige siempre con
+ * aritmética entera exacta:
+ *
+ *     mientras r^k > n:        r = r - 1
+ *     mientras (r + 1)^k <= n: r = r + 1
+ *
+ * y, si la raíz tiene más de 50 bits (sólo sqrt de uint128_t), con un paso
+ * de Newton previo que duplica los bits correctos.
+ *
+ * Los tipos de Boost (y la evaluación en tiempo de compilación) usan
+ * Newton entero desde arriba, con la semilla 2^(floor(log2(n) / k) + 1) > r:
+ *
+ *     x' = ((k - 1) * x + n / x^(k-1)) / k
+ *
+ * La sucesión decrece estrictamente hasta llegar a floor(n^(1/k)).
+ * ==============================================================================
+ */
+
+#include <array>
+#include <cmath>   // Para std::sqrt, std::cbrt, std::pow
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t
+#include <numbers_calculations/core/checked_arith.hpp> // Para mul_overflow
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_supported_integer_v
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/integer_ops.hpp> // Para integer_log2, integer_power
+#include <numbers_calculations/math/internal/prime_sieve.hpp> // Para sieve_primes
+#include <type_traits>
+#include <utility> // Para std::move
+
+namespace numbers_calculations::math {
+
+namespace internal {
+
+// Raíces con más bits que éstos no se fían de la semilla `double`.
+inline constexpr unsigned int ROOT_SEED_EXACT_BITS = 50;
+
+// Primos < 128: exponentes candidatos de is_perfect_power para tipos
+// nativos (n < 2^128 sólo puede ser x^p con p < 128).
+inline constexpr std::array<unsigned int, 31> PERFECT_POWER_PRIMES = {
+    2,  3,  5,  7,  11, 13, 17, 19, 23, 29,  31,  37,  41,  43,  47, 53,
+    59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127};
+
+// Cota de los módulos de los filtros de residuos (el mayor es 1091, p = 109).
+inline constexpr unsigned int POWER_RESIDUE_MAX_MODULUS = 2048;
+
+/**
+ * @brief Filtro de residuos para un exponente primo p: máscara de los
+ * restos módulo q (primo, q = 1 mod p) que son potencias p-ésimas.
+ *
+ * Sólo (q - 1) / p + 1 de los q restos lo son, así que una división
+ * descarta casi todos los candidatos antes de calcular ninguna raíz.
+ */
+struct PowerResidueFilter {
+  unsigned int modulus = 0;
+  std::array<std::uint64_t, POWER_RESIDUE_MAX_MODULUS / 64> mask{};
+
+  constexpr bool admits(unsigned int residue) const noexcept {
+    return ((mask[residue / 64] >> (residue % 64)) & 1) != 0;
+  }
+};
+
+constexpr bool is_small_prime(unsigned int n) noexcept {
+  for (unsigned int d = 2; d * d <= n; ++d) {
+    if (n % d == 0) {
+      return false;
+    }
+  }
+  return n > 1;
+}
+
+constexpr PowerResidueFilter make_power_residue_filter(unsigned int p) {
+  PowerResidueFilter filter{};
+  unsigned int q = 2 * p + 1;
+  while (!is_small_prime(q)) {
+    q += 2 * p;
+  }
+  filter.modulus = q;
+  for (std::uint64_t x = 0; x < q; ++x) {
+    std::uint64_t power = 1;
+    for (unsigned int i = 0; i < p; ++i) {
+      power = power * x % q;
+    }
+    filter.mask[power / 64] |= std::uint64_t{1} << (power % 64);
+  }
+  return filter;
+}
+
+// Un filtro por cada primo de PERFECT_POWER_PRIMES.
+inline constexpr auto POWER_RESIDUE_FILTERS = [] {
+  std::array<PowerResidueFilter, PERFECT_POWER_PRIMES.size()> filters{};
+  for (std::size_t i = 0; i < filters.size(); ++i) {
+    filters[i] = make_power_residue_filter(PERFECT_POWER_PRIMES[i]);
+  }
+  return filters;
+}();
+
+// Cuadrados módulo 64: el filtro clásico para p = 2 (12 de 64 restos).
+inline constexpr std::uint64_t SQUARES_MOD_64 = [] {
+  std::uint64_t mask = 0;
+  for (std::uint64_t x = 0; x < 64; ++x) {
+    mask |= std::uint64_t{1} << (x * x % 64);
+  }
+  return mask;
+}();
+
+/**
+ * @brief false si n seguro que no es una potencia p-ésima (p primo).
+ */
+template <typename U>
+constexpr bool passes_power_residue_filter(const U &n,
+                                           unsigned int p) noexcept {
+  if (p == 2 &&
+      ((SQUARES_MOD_64 >> static_cast<unsigned int>(n & 63)) & 1) == 0) {
+    return false;
+  }
+  for (std::size_t i = 0; i < PERFECT_POWER_PRIMES.size(); ++i) {
+    if (PERFECT_POWER_PRIMES[i] == p) {
+      const PowerResidueFilter &filter = POWER_RESIDUE_FILTERS[i];
+      return filter.admits(static_cast<unsigned int>(n % filter.modulus));
+    }
+  }
+  return true; // p > 127 (sólo Boost): sin filtro
+}
+
+/**
+ * @brief floor(log2(n)) para n > 0 (nativo sin signo o Boost positivo).
+ */
+template <typename U> constexpr unsigned int root_log2(const U &n) noexcept {
+  if constexpr (core::is_boost_integer_v<U>) {
+    return static_cast<unsigned int>(boost::multiprecision::msb(n));
+  } else {
+    return *integer_log2(n);
+  }
+}
+
+/**
+ * @brief true si x^k > n. Para tipos nativos multiplica de uno en uno y
+ * se detiene en cuanto supera n (o desborda); k < bits(U) siempre.
+ */
+template <typename U>
+constexpr bool power_exceeds(const U &x, unsigned int k, const U &n) noexcept {
+  if constexpr (core::is_boost_integer_v<U>) {
+    const auto power = integer_power(x, k);
+    return !power.has_value() || *power > n;
+  } else {
+    U power = x;
+    for (unsigned int i = 1; i < k; ++i) {
+      if (core::mul_overflow(power, x, power) || power > n) {
+        return true;
+      }
+    }
+    return power > n;
+  }
+}
+
+/**
+ * @brief Un paso de Newton: ((k - 1) * x + n / x^(k-1)) / k, con x > 0.
+ *
+ * Partiendo de cualquier x > 0 el resultado es >= floor(n^(1/k)).
+ */
+template <typename U>
+constexpr U newton_root_step(const U &n, unsigned int k, const U &x) noexcept {
+  const auto power = integer_power(x, k - 1);
+  // Si x^(k-1) no cabe en U, es mayor que n: el cociente es 0
+  const U quotient = power.has_value() ? U(n / *power) : U{0};
+  return U((U(k - 1) * x + quotient) / U(k));
+}
+
+/**
+ * @brief floor(n^(1/k)) por Newton entero desde arriba (n >= 2^k).
+ */
+template <typename U>
+constexpr U newton_root(const U &n, unsigned int k,
+                        unsigned int log2_n) noexcept {
+  U x = static_cast<U>(U{1} << (log2_n / k + 1)); // > n^(1/k)
+  while (true) {
+    U next = newton_root_step(n, k, x);
+    if (next >= x) {
+      return x;
+    }
+    x = std::move(next);
+  }
+}
+
+/**
+ * @brief Semilla de coma flotante para n^(1/k).
+ */
+inline double floating_root(double n, unsigned int k) noexcept {
+  if (k == 2) {
+    return std::sqrt(n);
+  }
+  if (k == 3) {
+    return std::cbrt(n);
+  }
+  return std::pow(n, 1.0 / k);
+}
+
+/**
+ * @brief floor(n^(1/k)) para tipos nativos: semilla `double` y corrección
+ * exacta (n >= 2^k).
+ */
+template <typename U>
+U seeded_root(U n, unsigned int k, unsigned int log2_n) noexcept {
+  U r = static_cast<U>(floating_root(static_cast<double>(n), k));
+  if (log2_n / k >= ROOT_SEED_EXACT_BITS) {
+    r = newton_root_step(n, k, r);
+  }
+  while (power_exceeds(r, k, n)) {
+    --r;
+  }
+  while (!power_exceeds(static_cast<U>(r + 1), k, n)) {
+    ++r;
+  }
+  return r;
+}
+
+/**
+ * @brief floor(n^(1/k)) para n >= 1 y k >= 2 (nativo sin signo o Boost
+ * positivo).
+ */
+template <typename U>
+constexpr U root_of_magnitude(const U &n, unsigned int k) noexcept {
+  const unsigned int log2_n = root_log2(n);
+  if (k > log2_n) {
+    return U{1}; // n < 2^k
+  }
+  if constexpr (!core::is_boost_integer_v<U>) {
+#if defined(HAS_IS_CONSTANT_EVALUATED)
+    if (!IS_CONSTANT_EVALUATED()) {
+      return seeded_root(n, k, log2_n);
+    }
+#endif
+  }
+  return newton_root(n, k, log2_n);
+}
+
+/**
+ * @brief true si n (>= 2) es x^p para algún primo p de la lista, con p
+ * impar si `odd_only`.
+ *
+ * Si n = 2^t * impar con t > 0, sólo pueden servir los p que dividen a t.
+ */
+template <typename U, typename Primes>
+constexpr bool has_prime_power_root(const U &n, const Primes &primes,
+                                    bool odd_only) noexcept {
+  const unsigned int log2_n = root_log2(n);
+  const unsigned int twos = trailing_zeros(n);
+  for (const auto p : primes) {
+    if (p > log2_n) {
+      break;
+    }
+    if ((odd_only && p == 2) || (twos != 0 && twos % p != 0) ||
+        !passes_power_residue_filter(n, static_cast<unsigned int>(p))) {
+      continue;
+    }
+    const U root = root_of_magnitude(n, static_cast<unsigned int>(p));
+    const auto power = integer_power(root, static_cast<unsigned int>(p));
+    if (power.has_value() && *power == n) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace internal
+
+// ==========================================================================
+// API PÚBLICA: raíces enteras
+// ==========================================================================
+
+/**
+ * @brief Calcula la raíz k-ésima entera floor(n^(1/k)).
+ *
+ * Para n < 0 y k impar devuelve -floor(|n|^(1/k)) (la raíz real truncada
+ * hacia cero).
+ *
+ * @tparam T Tipo entero (con o sin signo).
+ * @param n El radicando.
+ * @param k El índice de la raíz (>= 1).
+ * @return Un `core::Expected<T>`:
+ * - .value() con la raíz.
+ * - .error() (MathError::DomainError) si k == 0 o si n < 0 con k par.
+ *
+ * @test_property integer_nth_root(1000, 3) == 10
+ * @test_property integer_nth_root(999, 3) == 9
+ * @test_property integer_nth_root(2^64 - 1, 64) == 1
+ * @test_property integer_nth_root(-27, 3) == -3
+ * @test_property integer_nth_root(-4, 2) == MathError::DomainError
+ *
+ * @optimize_note Tipos nativos: O(1) (semilla `double` y una o dos
+ *                comparaciones exactas). En evaluación constante y para
+ *                Boost: Newton, O(log(bits)) pasos.
+ */
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+constexpr core::Expected<T> integer_nth_root(const T &n,
+                                             unsigned int k) noexcept {
+  bool negative = false;
+  if constexpr (core::is_signed_v<T>) {
+    negative = n < 0;
+  }
+  if (k == 0 || (negative && k % 2 == 0)) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  if (k == 1 || n == 0) {
+    return n;
+  }
+
+  if constexpr (core::is_boost_integer_v<T>) {
+    if constexpr (core::is_signed_v<T>) {
+      if (negative) {
+        return T{-internal::root_of_magnitude(T{-n}, k)};
+      }
+    }
+    return internal::root_of_magnitude(n, k);
+  } else {
+    using U = typename internal::unsigned_counterpart<T>::type;
+    // |n| en aritmética sin signo (válido también para el mínimo)
+    const U magnitude =
+        negative ? static_cast<U>(U{0} - static_cast<U>(n)) : static_cast<U>(n);
+    const auto root = static_cast<T>(internal::root_of_magnitude(magnitude, k));
+    return negative ? static_cast<T>(-root) : root;
+  }
+}
+
+/**
+ * @brief Calcula la raíz cuadrada entera floor(sqrt(n)).
+ *
+ * @return Un `core::Expected<T>` con la raíz o `MathError::DomainError`
+ * si n < 0.
+ *
+ * @test_property integer_sqrt(99) == 9
+ * @test_property integer_sqrt(2^64 - 1) == 2^32 - 1
+ * @test_property integer_sqrt(2^128 - 1) (uint128_t) == 2^64 - 1
+ */
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+constexpr core::Expected<T> integer_sqrt(const T &n) noexcept {
+  return integer_nth_root(n, 2);
+}
+
+/**
+ * @brief Calcula la raíz cúbica entera (truncada hacia cero si n < 0).
+ *
+ * @test_property integer_cbrt(26) == 2
+ * @test_property integer_cbrt(27) == 3
+ * @test_property integer_cbrt(-28) == -3
+ */
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+constexpr core::Expected<T> integer_cbrt(const T &n) noexcept {
+  return integer_nth_root(n, 3);
+}
+
+/**
+ * @brief Indica si n = x^k para algún entero x y algún k >= 2.
+ *
+ * Sigue el convenio de GMP (`mpz_perfect_power_p`): 0 y 1 son potencias
+ * perfectas, y un n negativo lo es si se escribe con k impar
+ * (-8 = (-2)^3 sí, -4 no).
+ *
+ * @test_property is_perfect_power(1024) == true
+ * @test_property is_perfect_power(1000) == true
+ * @test_property is_perfect_power(12) == false
+ * @test_property is_perfect_power(3^80) (uint128_t) == true
+ *
+ * @optimize_note Basta probar exponentes primos p <= log2(n), y de ellos
+ *                sólo los que dividen al número de ceros finales de n y
+ *                pasan un filtro de residuos (una división): la raíz sólo
+ *                se calcula para ~1/p de los candidatos.
+ */
+template <typename T,
+          std::enable_if_t<core::is_supported_integer_v<T>, int> = 0>
+constexpr bool is_perfect_power(const T &n) noexcept {
+  bool negative = false;
+  if constexpr (core::is_signed_v<T>) {
+    negative = n < 0;
+    if (n == -1) {
+      return true;
+    }
+  }
+  if (n == 0 || n == 1) {
+    return true;
+  }
+
+  if constexpr (core::is_boost_integer_v<T>) {
+    const T magnitude = core::internal::boost_abs(n);
+    const auto primes = internal::sieve_primes(static_cast<std::uint32_t>(
+        boost::multiprecision::msb(magnitude)));
+    return internal::has_prime_power_root(magnitude, primes, negative);
+  } else {
+    using U = typename internal::unsigned_counterpart<T>::type;
+    const U magnitude =
+        negative ? static_cast<U>(U{0} - static_cast<U>(n)) : static_cast<U>(n);
+    return internal::has_prime_power_root(
+        magnitude, internal::PERFECT_POWER_PRIMES, negative);
+  }
+}
+
+} // namespace numbers_calculations::math
@@ -0,0 +1,131 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: addition_chain.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Genera en tiempo de compilación cadenas de adición para exponentes
+ * constantes, usadas por `integer_power<Exp>(base)`.
+ *
+ * Explicación didáctica:
+ * Una cadena de adición para e es una sucesión 1 = a_0 < a_1 < ... < a_r = e
+ * en la que cada término es la suma de dos anteriores (a_i = a_j + a_k).
+ * Cada término se traduce en una multiplicación: x^(a_i) = x^(a_j) * x^(a_k),
+ * así que la longitud r es el número de productos necesarios para x^e.
+ *
+ * El método binario (cuadrados y multiplicaciones) no siempre es óptimo:
+ *
+ *     x^15 binario:  1 2 3 6 7 14 15   (6 productos)
+ *     x^15 óptimo:   1 2 3 5 10 15     (5 productos)
+ *
+ * Para e <= ADDITION_CHAIN_SEARCH_LIMIT se busca una cadena óptima por
+ * profundización iterativa entre las cadenas "estrella" (de Brauer, en las
+ * que cada término usa el anterior), que son óptimas para todo e < 12509.
+ * Por encima se usa el método binario.
+ * ==============================================================================
+ */
+
+#include <array>
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t, std::uint8_t
+
+namespace numbers_calculations::math::internal {
+
+// Exponente máximo para el que se busca la cadena óptima.
+inline constexpr std::uint64_t ADDITION_CHAIN_SEARCH_LIMIT = 128;
+
+// Longitud máxima de una cadena (método binario para 64 bits: 2 * 63).
+inline constexpr std::size_t ADDITION_CHAIN_MAX_LENGTH = 128;
+
+/**
+ * @brief Cadena de adición: el paso i calcula
+ * x^(exponents[i+1]) = x^(exponents[lhs[i]]) * x^(exponents[rhs[i]]).
+ */
+struct AdditionChain {
+  std::size_t length = 0; // Número de productos
+  std::array<std::uint64_t, ADDITION_CHAIN_MAX_LENGTH + 1> exponents{};
+  std::array<std::uint8_t, ADDITION_CHAIN_MAX_LENGTH> lhs{};
+  std::array<std::uint8_t, ADDITION_CHAIN_MAX_LENGTH> rhs{};
+};
+
+/**
+ * @brief Búsqueda en profundidad (acotada a `max_depth`) de una cadena
+ * estrella que termine en `target`.
+ */
+constexpr bool search_star_chain(AdditionChain &chain, std::uint64_t target,
+                                 std::size_t depth, std::size_t max_depth) {
+  const std::uint64_t current = chain.exponents[depth];
+  if (current == target) {
+    chain.length = depth;
+    return true;
+  }
+  // Poda: ni duplicando en cada paso restante se alcanza el objetivo
+  if (depth == max_depth || (current << (max_depth - depth)) < target) {
+    return false;
+  }
+  for (std::size_t j = depth + 1; j-- > 0;) {
+    const std::uint64_t next = current + chain.exponents[j];
+    if (next > target) {
+      continue;
+    }
+    chain.exponents[depth + 1] = next;
+    chain.lhs[depth] = static_cast<std::uint8_t>(depth);
+    chain.rhs[depth] = static_cast<std::uint8_t>(j);
+    if (search_star_chain(chain, target, depth + 1, max_depth)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Cadena del método binario (de izquierda a derecha).
+ */
+constexpr AdditionChain binary_addition_chain(std::uint64_t exp) {
+  AdditionChain chain{};
+  chain.exponents[0] = 1;
+  int top = 63;
+  while (((exp >> top) & 1) == 0) {
+    --top;
+  }
+  std::size_t i = 0;
+  for (int bit = top - 1; bit >= 0; --bit) {
+    // Cuadrado
+    chain.exponents[i + 1] = 2 * chain.exponents[i];
+    chain.lhs[i] = chain.rhs[i] = static_cast<std::uint8_t>(i);
+    ++i;
+    if ((exp >> bit) & 1) {
+      // Multiplicación por la base (x^1 = índice 0)
+      chain.exponents[i + 1] = chain.exponents[i] + 1;
+      chain.lhs[i] = static_cast<std::uint8_t>(i);
+      chain.rhs[i] = 0;
+      ++i;
+    }
+  }
+  chain.length = i;
+  return chain;
+}
+
+/**
+ * @brief Cadena de adición (óptima si exp <= ADDITION_CHAIN_SEARCH_LIMIT)
+ * para un exponente exp >= 1.
+ */
+constexpr AdditionChain make_addition_chain(std::uint64_t exp) {
+  if (exp <= ADDITION_CHAIN_SEARCH_LIMIT) {
+    AdditionChain chain{};
+    chain.exponents[0] = 1;
+    for (std::size_t max_depth = 0;; ++max_depth) {
+      if (search_star_chain(chain, exp, 0, max_depth)) {
+        return chain;
+      }
+    }
+  }
+  return binary_addition_chain(exp);
+}
+
+// Cadena generada una sola vez por exponente.
+template <std::uint64_t Exp>
+inline constexpr AdditionChain ADDITION_CHAIN = make_addition_chain(Exp);
+
+} // namespace numbers_calculations::math::internal
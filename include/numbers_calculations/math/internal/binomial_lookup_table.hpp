@@ -0,0 +1,96 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: binomial_lookup_table.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Define las tablas de búsqueda (LUTs) `constexpr` para coeficientes
+ * binomiales C(n, k), generadas con el triángulo de Pascal.
+ *
+ * Sólo se guarda la mitad izquierda de cada fila (k <= n/2), ya que
+ * C(n, k) == C(n, n-k). Las filas se empaquetan una tras otra en un único
+ * array plano y un segundo array guarda dónde empieza cada fila:
+ *
+ *     values:  [1 | 1 | 1 2 | 1 3 | 1 4 6 | 1 5 10 | ...]
+ *     offsets: [0,  1,  2,    4,    6,      9,  ...]
+ *
+ *     C(n, k) = values[offsets[n] + k]      (k <= n/2)
+ * ==============================================================================
+ */
+
+#include <array>
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para uint128_t
+
+namespace numbers_calculations::math::internal {
+
+/**
+ * @brief Número de entradas de una tabla triangular de `Rows` filas
+ * (sólo k <= n/2).
+ */
+constexpr std::size_t binomial_lut_size(std::size_t rows) {
+  std::size_t size = 0;
+  for (std::size_t n = 0; n < rows; ++n) {
+    size += n / 2 + 1;
+  }
+  return size;
+}
+
+/**
+ * @brief Tabla triangular empaquetada de coeficientes binomiales.
+ *
+ * @tparam T Tipo de entero de las entradas.
+ * @tparam Rows Número de filas (n = 0 .. Rows-1).
+ */
+template <typename T, std::size_t Rows> struct BinomialLut {
+  std::array<std::size_t, Rows> offsets{};
+  std::array<T, binomial_lut_size(Rows)> values{};
+
+  static constexpr std::size_t rows() { return Rows; }
+
+  /**
+   * @brief Devuelve C(n, k). Requiere n < Rows y k <= n.
+   */
+  constexpr T operator()(std::size_t n, std::size_t k) const {
+    if (k > n / 2) {
+      k = n - k;
+    }
+    return values[offsets[n] + k];
+  }
+};
+
+/**
+ * @brief Generador Constexpr para la LUT de binomiales (triángulo de Pascal).
+ *
+ * @tparam T Tipo de entero (uint64_t o uint128_t).
+ * @tparam Rows Número de filas. Todas las entradas deben caber en T.
+ */
+template <typename T, std::size_t Rows>
+constexpr BinomialLut<T, Rows> generate_binomial_lut() {
+  BinomialLut<T, Rows> table{};
+  std::size_t offset = 0;
+  for (std::size_t n = 0; n < Rows; ++n) {
+    table.offsets[n] = offset;
+    for (std::size_t k = 0; k <= n / 2; ++k) {
+      if (k == 0) {
+        table.values[offset + k] = 1;
+      } else {
+        // C(n, k) = C(n-1, k-1) + C(n-1, k)
+        table.values[offset + k] = table(n - 1, k - 1) + table(n - 1, k);
+      }
+    }
+    offset += n / 2 + 1;
+  }
+  return table;
+}
+
+// C(67, 33) es el último binomial central que cabe en un uint64_t.
+constexpr auto BINOMIALS_LUT_64 = generate_binomial_lut<std::uint64_t, 68>();
+
+// C(131, 65) es el último binomial central que cabe en un uint128_t.
+constexpr auto BINOMIALS_LUT_128 =
+    generate_binomial_lut<numbers_calculations::core::uint128_t, 132>();
+
+} // namespace numbers_calculations::math::internal
@@ -0,0 +1,163 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: combinatorial_numbers_lut.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Define las tablas de búsqueda (LUTs) `constexpr` para números de Catalan,
+ * números de Bell y números de Stirling de ambas especies, hasta el límite
+ * de uint128_t.
+ *
+ * Los triángulos de Stirling se guardan completos (k = 0..n) en un array
+ * plano, con un segundo array que indica dónde empieza cada fila:
+ *
+ *     values:  [1 | 0 1 | 0 1 1 | 0 1 3 1 | ...]
+ *     offsets: [0,  1,    3,      6,  ...]
+ *
+ *     S(n, k) = values[offsets[n] + k]      (k <= n)
+ * ==============================================================================
+ */
+
+#include <array>
+#include <cstddef> // Para std::size_t
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para uint128_t
+
+namespace numbers_calculations::math::internal {
+
+/**
+ * @brief Número de entradas de un triángulo completo de `rows` filas.
+ */
+constexpr std::size_t triangle_lut_size(std::size_t rows) {
+  return rows * (rows + 1) / 2;
+}
+
+/**
+ * @brief Tabla triangular empaquetada (filas completas, k = 0..n).
+ *
+ * @tparam T Tipo de entero de las entradas.
+ * @tparam Rows Número de filas (n = 0 .. Rows-1).
+ */
+template <typename T, std::size_t Rows> struct TriangleLut {
+  std::array<std::size_t, Rows> offsets{};
+  std::array<T, triangle_lut_size(Rows)> values{};
+
+  static constexpr std::size_t rows() { return Rows; }
+
+  /**
+   * @brief Devuelve la entrada (n, k). Requiere n < Rows y k <= n.
+   */
+  constexpr T operator()(std::size_t n, std::size_t k) const {
+    return values[offsets[n] + k];
+  }
+};
+
+/**
+ * @brief Generador Constexpr para los triángulos de Stirling.
+ *
+ * Ambas especies siguen la recurrencia
+ *
+ *     S(n, k) = m(n, k) * S(n-1, k) + S(n-1, k-1)
+ *
+ * con m = n - 1 (primera especie, sin signo) o m = k (segunda especie).
+ *
+ * @tparam FirstKind true para la primera especie, false para la segunda.
+ */
+template <typename T, std::size_t Rows, bool FirstKind>
+constexpr TriangleLut<T, Rows> generate_stirling_lut() {
+  TriangleLut<T, Rows> table{};
+  std::size_t offset = 0;
+  for (std::size_t n = 0; n < Rows; ++n) {
+    table.offsets[n] = offset;
+    table.values[offset] = n == 0 ? 1 : 0;
+    for (std::size_t k = 1; k <= n; ++k) {
+      const T above = k < n ? table(n - 1, k) : T{0};
+      const T multiplier = FirstKind ? T(n - 1) : T(k);
+      table.values[offset + k] = multiplier * above + table(n - 1, k - 1);
+    }
+    offset += n + 1;
+  }
+  return table;
+}
+
+/**
+ * @brief Máximo común divisor (Euclides), para el generador de Catalan.
+ */
+template <typename T> constexpr T lut_gcd(T a, T b) {
+  while (b != 0) {
+    const T r = a % b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
+
+/**
+ * @brief Generador Constexpr para la LUT de números de Catalan.
+ *
+ * Usa C(n+1) = C(n) * 2(2n+1) / (n+2). Para no desbordar con el producto
+ * intermedio se divide antes C(n) entre g = gcd(C(n), n+2); el resto del
+ * divisor, (n+2)/g, divide exactamente a 2(2n+1).
+ */
+template <typename T, std::size_t N>
+constexpr std::array<T, N> generate_catalan_lut() {
+  std::array<T, N> table{};
+  table[0] = 1;
+  for (std::size_t n = 0; n + 1 < N; ++n) {
+    const T divisor = T(n + 2);
+    const T g = lut_gcd(table[n], divisor);
+    table[n + 1] = table[n] / g * (T(2 * (2 * n + 1)) / (divisor / g));
+  }
+  return table;
+}
+
+/**
+ * @brief Generador Constexpr para la LUT de números de Bell.
+ *
+ * Usa el triángulo de Bell (Aitken): cada fila empieza con el último
+ * elemento de la anterior y cada entrada es la suma de su vecina izquierda
+ * y de la que tiene encima. La fila n termina en B(n+1), que es su mayor
+ * entrada, así que nunca se calcula un valor mayor que el último de la LUT.
+ */
+template <typename T, std::size_t N>
+constexpr std::array<T, N> generate_bell_lut() {
+  std::array<T, N> table{};
+  std::array<T, N> row{};
+  table[0] = 1;
+  row[0] = 1; // Fila 0 = {1}
+  for (std::size_t n = 0; n + 1 < N; ++n) {
+    if (n > 0) {
+      // Fila n a partir de la fila n-1, in situ: `previous` guarda la
+      // entrada antigua que tiene encima la posición actual
+      T previous = row[0];
+      row[0] = row[n - 1];
+      for (std::size_t i = 1; i <= n; ++i) {
+        const T above = previous;
+        previous = row[i];
+        row[i] = row[i - 1] + above;
+      }
+    }
+    table[n + 1] = row[n]; // B(n+1) = último elemento de la fila n
+  }
+  return table;
+}
+
+// C(69) es el último número de Catalan que cabe en un uint128_t.
+constexpr auto CATALANS_LUT =
+    generate_catalan_lut<numbers_calculations::core::uint128_t, 70>();
+
+// B(42) es el último número de Bell que cabe en un uint128_t.
+constexpr auto BELLS_LUT =
+    generate_bell_lut<numbers_calculations::core::uint128_t, 43>();
+
+// La fila 34 es la última de la primera especie que cabe entera en un
+// uint128_t (c(35, 1) = 34! aún cabe; c(35, 2) = 34! * H_34 ya desborda).
+constexpr auto STIRLING_FIRST_LUT =
+    generate_stirling_lut<numbers_calculations::core::uint128_t, 35, true>();
+
+// La fila 43 es la última de la segunda especie que cabe entera en un
+// uint128_t.
+constexpr auto STIRLING_SECOND_LUT =
+    generate_stirling_lut<numbers_calculations::core::uint128_t, 44, false>();
+
+} // namespace numbers_calculations::math::internal
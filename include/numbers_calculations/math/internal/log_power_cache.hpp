@@ -0,0 +1,210 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: log_power_cache.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Respalda `integer_log(base, n)` para bases distintas de 2 y 10 con una
+ * estimación O(1) y una caché por hilo de tablas de potencias de la base.
+ *
+ * Explicación didáctica:
+ * Si n tiene w bits, 2^(w-1) <= n < 2^w, y por tanto
+ *
+ *     (w - 1) / log2(b)  <=  log_b(n)  <  w / log2(b)
+ *
+ * El intervalo mide 1 / log2(b) < 1 (b >= 3), así que k = floor((w-1) /
+ * log2(b)) es el resultado o se queda corto en uno: basta una comparación
+ * con b^(k+1). La división por log2(b) se hace con un recíproco en punto
+ * fijo (Q32) calculado una sola vez por base y redondeado a la baja, para
+ * que la estimación nunca se pase.
+ *
+ * Las potencias de b se guardan en una caché `thread_local` (sin bloqueos,
+ * como `modular_factorial_table`) con las LOG_BASE_CACHE_SIZE últimas
+ * bases usadas:
+ * - Tipos nativos (hasta 128 bits): la tabla completa b^0 .. b^max.
+ * - Tipos de Boost: la "escalera" de cuadrados b, b^2, b^4, b^8... que se
+ *   amplía bajo demanda; b^k se obtiene con popcount(k) productos.
+ * ==============================================================================
+ */
+
+#include <array>
+#include <cmath>   // Para std::log2
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t
+#include <limits>  // Para numeric_limits
+#include <numbers_calculations/core/checked_arith.hpp> // Para mul_overflow
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para uint128_t
+#include <utility> // Para std::move
+#include <vector>
+
+namespace numbers_calculations::math::internal {
+
+// Número de bases distintas que recuerda cada hilo.
+inline constexpr std::size_t LOG_BASE_CACHE_SIZE = 8;
+
+// Bits fraccionarios del recíproco de log2(base).
+inline constexpr unsigned LOG_RECIPROCAL_BITS = 32;
+
+// 3^80 es la mayor potencia de la menor base (3) que cabe en 128 bits.
+inline constexpr std::size_t LOG_NATIVE_MAX_POWERS = 81;
+
+/**
+ * @brief floor(2^32 / log2(base)) redondeado a la baja (base >= 3).
+ *
+ * Se resta 1 para absorber el error del `double`: la estimación que se
+ * obtiene con él nunca supera el logaritmo real.
+ */
+inline std::uint64_t reciprocal_log2(std::uint64_t base) noexcept {
+  const double scale = static_cast<double>(std::uint64_t{1}
+                                           << LOG_RECIPROCAL_BITS);
+  return static_cast<std::uint64_t>(
+             scale / std::log2(static_cast<double>(base))) -
+         1;
+}
+
+/**
+ * @brief Estimación por defecto de log_base(n) a partir de la anchura en
+ * bits de n (resultado real: k o k + 1).
+ */
+inline std::uint64_t estimate_log(std::uint64_t bit_width,
+                                  std::uint64_t reciprocal) noexcept {
+  return static_cast<std::uint64_t>(
+      (static_cast<core::uint128_t>(bit_width - 1) * reciprocal) >>
+      LOG_RECIPROCAL_BITS);
+}
+
+// ==========================================================================
+// Tipos nativos: tabla completa de potencias en uint128_t
+// ==========================================================================
+
+/**
+ * @brief Potencias base^0 .. base^(count-1) que caben en un uint128_t.
+ */
+struct NativeLogTable {
+  std::uint64_t base = 0; // 0 = entrada libre
+  std::uint64_t reciprocal = 0;
+  std::size_t count = 0;
+  std::array<core::uint128_t, LOG_NATIVE_MAX_POWERS> powers{};
+
+  void build(std::uint64_t b) noexcept {
+    base = b;
+    reciprocal = reciprocal_log2(b);
+    powers[0] = 1;
+    count = 1;
+    while (count < powers.size() &&
+           !core::mul_overflow(powers[count - 1], core::uint128_t{b},
+                               powers[count])) {
+      ++count;
+    }
+  }
+};
+
+/**
+ * @brief Devuelve la tabla del hilo actual para `base` (3 <= base < 2^64),
+ * construyéndola si no está en la caché.
+ */
+inline const NativeLogTable &native_log_table(std::uint64_t base) noexcept {
+  thread_local std::array<NativeLogTable, LOG_BASE_CACHE_SIZE> cache{};
+  thread_local std::size_t next_slot = 0;
+  for (const NativeLogTable &table : cache) {
+    if (table.base == base) {
+      return table;
+    }
+  }
+  // Reemplazo circular: la entrada más antigua
+  NativeLogTable &slot = cache[next_slot];
+  next_slot = (next_slot + 1) % LOG_BASE_CACHE_SIZE;
+  slot.build(base);
+  return slot;
+}
+
+/**
+ * @brief floor(log_base(n)) para 3 <= base < 2^64 y n >= 1, dada la
+ * anchura en bits de n (1..128).
+ */
+inline unsigned int cached_log_native(std::uint64_t base, core::uint128_t n,
+                                      unsigned int bit_width) noexcept {
+  const NativeLogTable &table = native_log_table(base);
+  const auto k =
+      static_cast<std::size_t>(estimate_log(bit_width, table.reciprocal));
+  // Si base^(k+1) no cabe en la tabla, tampoco puede ser <= n
+  const bool next = k + 1 < table.count && n >= table.powers[k + 1];
+  return static_cast<unsigned int>(k + (next ? 1 : 0));
+}
+
+// ==========================================================================
+// Tipos de Boost: escalera de cuadrados
+// ==========================================================================
+
+/**
+ * @brief Escalera base^(2^i), ampliada bajo demanda.
+ */
+template <typename T> struct BigLogLadder {
+  std::uint64_t base = 0; // 0 = entrada libre
+  std::uint64_t reciprocal = 0;
+  std::vector<T> squares;
+
+  void build(std::uint64_t b) {
+    base = b;
+    reciprocal = reciprocal_log2(b);
+    squares.assign(1, T{b});
+  }
+
+  /**
+   * @brief base^(2^i). Sólo se pide con 2^i <= log_base(n), así que el
+   * cuadrado nunca supera a n (no desborda en tipos acotados).
+   */
+  const T &square(std::size_t i) {
+    while (squares.size() <= i) {
+      T next = squares.back() * squares.back();
+      squares.push_back(std::move(next));
+    }
+    return squares[i];
+  }
+};
+
+template <typename T> BigLogLadder<T> &big_log_ladder(std::uint64_t base) {
+  thread_local std::array<BigLogLadder<T>, LOG_BASE_CACHE_SIZE> cache{};
+  thread_local std::size_t next_slot = 0;
+  for (BigLogLadder<T> &ladder : cache) {
+    if (ladder.base == base) {
+      return ladder;
+    }
+  }
+  BigLogLadder<T> &slot = cache[next_slot];
+  next_slot = (next_slot + 1) % LOG_BASE_CACHE_SIZE;
+  slot.build(base);
+  return slot;
+}
+
+/**
+ * @brief floor(log_base(n)) para 3 <= base < 2^64 y n >= 1 (Boost).
+ *
+ * Para n de millones de bits el error del recíproco puede dejar la
+ * estimación más de una unidad corta; el bucle de corrección lo absorbe
+ * (normalmente hace una sola comparación).
+ */
+template <typename T>
+unsigned int cached_log_big(std::uint64_t base, const T &n) {
+  BigLogLadder<T> &ladder = big_log_ladder<T>(base);
+  const auto bit_width =
+      static_cast<std::uint64_t>(boost::multiprecision::msb(n)) + 1;
+  std::uint64_t k = estimate_log(bit_width, ladder.reciprocal);
+
+  // power = base^k con popcount(k) productos de la escalera
+  T power{1};
+  for (std::size_t i = 0; (k >> i) != 0; ++i) {
+    if ((k >> i) & 1) {
+      power *= ladder.square(i);
+    }
+  }
+  T next{};
+  while (!core::mul_overflow(power, T{base}, next) && next <= n) {
+    power = std::move(next);
+    ++k;
+  }
+  return static_cast<unsigned int>(k);
+}
+
+} // namespace numbers_calculations::math::internal
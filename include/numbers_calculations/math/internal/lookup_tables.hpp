@@ -14,6 +14,7 @@
 // de nuestras tablas de alta precisión.
 #include <array>
 #include <limits>
+#include <numbers_calculations/core/checked_arith.hpp> // Para mul_overflow
 #include <numbers_calculations/core/extended_type_traits.hpp> // Para uint128_t
 
 namespace numbers_calculations::math::internal {
@@ -41,12 +42,10 @@ constexpr std::array<T, N> generate_power_lut(T base) {
   T current_power = 1;
   for (size_t i = 0; i < N; ++i) {
     if (i > 0) {
-      // Comprobación de overflow: (current_power * base) > max
-      if (current_power > std::numeric_limits<T>::max() / base) {
-        // El resto de la tabla serán 0 (indicador de overflow)
+      // El resto de la tabla serán 0 (indicador de overflow)
+      if (core::mul_overflow(current_power, base, current_power)) {
         break;
       }
-      current_power *= base;
     }
     table[i] = current_power;
   }
@@ -62,4 +61,44 @@ constexpr auto POWERS_OF_5 = generate_power_lut<uint128_t, 56>(5);
 // Base 10: 10^0 a 10^38 (39 valores)
 constexpr auto POWERS_OF_10 = generate_power_lut<uint128_t, 39>(10);
 
+// ----------------------------------------------------------------------
+// Tablas para integer_log10 en O(1)
+// ----------------------------------------------------------------------
+
+/**
+ * @brief Potencias de 10 en el propio tipo U: 10^0 .. 10^digits10.
+ *
+ * Comparar contra una tabla del tipo del argumento evita promocionar
+ * (por ejemplo) un uint32_t a 128 bits en cada comparación.
+ */
+template <typename U>
+inline constexpr auto POWERS_OF_10_FOR =
+    generate_power_lut<U, std::numeric_limits<U>::digits10 + 1>(U{10});
+
+/**
+ * @brief Generador Constexpr de la tabla de estimaciones de log10.
+ *
+ * Para cada anchura w (n en [2^(w-1), 2^w)), guarda floor(log10(2^w - 1)),
+ * el mayor log10 posible con w bits. El log10 real es ese valor o uno
+ * menos, según n sea o no menor que 10^estimación.
+ */
+constexpr std::array<unsigned char, 129> generate_log10_guess_lut() {
+  std::array<unsigned char, 129> table{};
+  unsigned char guess = 0;
+  for (std::size_t w = 1; w < table.size(); ++w) {
+    // 2^w - 1 sin desbordar para w = 128
+    const uint128_t largest = (uint128_t{1} << (w - 1)) - 1 +
+                              (uint128_t{1} << (w - 1));
+    while (static_cast<std::size_t>(guess) + 1 < POWERS_OF_10.size() &&
+           POWERS_OF_10[guess + 1] <= largest) {
+      ++guess;
+    }
+    table[w] = guess;
+  }
+  return table;
+}
+
+// Estimación de floor(log10(n)) indexada por la anchura en bits de n.
+constexpr auto LOG10_GUESS_BY_BIT_WIDTH = generate_log10_guess_lut();
+
 } // namespace numbers_calculations::math::internal
@@ -0,0 +1,162 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: modular_factorial_table.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Tablas de factoriales y factoriales inversos módulo un primo p, que
+ * respaldan `factorial_mod`, `permutations_mod` y `combinations_mod`.
+ *
+ * Explicación didáctica:
+ * Con fact[i] = i! mod p e inv_fact[i] = (i!)^(-1) mod p se tiene
+ *
+ *     C(n, k) = fact[n] * inv_fact[k] * inv_fact[n-k]   (mod p)
+ *
+ * La tabla se construye en O(N) con una sola exponenciación modular:
+ *
+ *     inv_fact[N]   = fact[N]^(p-2)          (pequeño teorema de Fermat)
+ *     inv_fact[i-1] = inv_fact[i] * i        (recorriendo hacia atrás)
+ *
+ * Las tablas se guardan en una caché `thread_local` (sin bloqueos) con los
+ * MOD_TABLE_CACHE_SIZE últimos módulos usados, así que alternar entre unos
+ * pocos primos no repite la construcción. Cada tabla crece bajo demanda
+ * hasta `MOD_TABLE_MAX_SIZE` entradas; cuando llega un módulo nuevo con la
+ * caché llena se descarta la tabla más antigua (reemplazo circular, como
+ * en `log_power_cache.hpp`).
+ * ==============================================================================
+ */
+
+#include <array>
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para wider_unsigned_t
+#include <vector>
+
+namespace numbers_calculations::math::internal {
+
+// Tamaño máximo de la tabla por módulo (entradas). Por encima se usa el
+// teorema de Lucas o productos directos.
+inline constexpr std::size_t MOD_TABLE_MAX_SIZE = std::size_t{1} << 20;
+
+// Número de módulos distintos que recuerda cada hilo. Una tabla llena ocupa
+// 2 * 8 * MOD_TABLE_MAX_SIZE bytes (16 MB con uint64_t), de ahí que sean pocos.
+inline constexpr std::size_t MOD_TABLE_CACHE_SIZE = 4;
+
+// Máximo de productos directos fuera de la tabla (~0.1 s). Por encima las
+// funciones modulares devuelven MathError::Overflow en lugar de bloquearse.
+inline constexpr std::uint64_t MOD_DIRECT_MAX_STEPS = std::uint64_t{1} << 24;
+
+/**
+ * @brief (a * b) mod m con el producto intermedio en el tipo de doble ancho.
+ */
+template <typename T>
+constexpr T mod_mul(T a, T b, T m) noexcept {
+  using W = core::wider_unsigned_t<T>;
+  return static_cast<T>(static_cast<W>(a) * static_cast<W>(b) %
+                        static_cast<W>(m));
+}
+
+/**
+ * @brief (base ^ exp) mod m por exponenciación binaria.
+ */
+template <typename T>
+constexpr T mod_pow(T base, std::uint64_t exp, T m) noexcept {
+  T result = static_cast<T>(1 % m);
+  base %= m;
+  while (exp > 0) {
+    if (exp & 1) {
+      result = mod_mul(result, base, m);
+    }
+    base = mod_mul(base, base, m);
+    exp >>= 1;
+  }
+  return result;
+}
+
+/**
+ * @brief Tabla de factoriales e inversos módulo un primo.
+ */
+template <typename T> struct ModularFactorialTable {
+  T modulus = 0; // 0 = entrada libre
+  std::vector<T> fact;
+  std::vector<T> inv_fact;
+
+  // Número de entradas disponibles (fact[0 .. size()-1]).
+  std::size_t size() const noexcept { return fact.size(); }
+
+  /**
+   * @brief Reconstruye la tabla para `p` con al menos `entries` entradas
+   * (nunca más de p, ni más de MOD_TABLE_MAX_SIZE).
+   */
+  void build(T p, std::size_t entries) {
+    if (entries > MOD_TABLE_MAX_SIZE) {
+      entries = MOD_TABLE_MAX_SIZE;
+    }
+    if (static_cast<std::uint64_t>(entries) > static_cast<std::uint64_t>(p)) {
+      entries = static_cast<std::size_t>(p); // i! = 0 para i >= p
+    }
+    if (p == modulus && entries <= fact.size()) {
+      return;
+    }
+
+    // Se construye aparte para que un std::bad_alloc deje la tabla intacta
+    std::vector<T> new_fact(entries);
+    std::vector<T> new_inv_fact(entries);
+    new_fact[0] = static_cast<T>(1 % p);
+    for (std::size_t i = 1; i < entries; ++i) {
+      new_fact[i] = mod_mul(new_fact[i - 1], static_cast<T>(i), p);
+    }
+    new_inv_fact[entries - 1] =
+        mod_pow(new_fact[entries - 1], static_cast<std::uint64_t>(p) - 2, p);
+    for (std::size_t i = entries - 1; i > 0; --i) {
+      new_inv_fact[i - 1] = mod_mul(new_inv_fact[i], static_cast<T>(i), p);
+    }
+    modulus = p;
+    fact.swap(new_fact);
+    inv_fact.swap(new_inv_fact);
+  }
+};
+
+/**
+ * @brief Devuelve la tabla del hilo actual para el módulo `p` y, si es
+ * posible, con entradas hasta `n` inclusive.
+ *
+ * Si `p` no está en la caché ocupa la entrada más antigua. La referencia es
+ * válida hasta la siguiente llamada en el mismo hilo.
+ * @throws std::bad_alloc si no se puede reservar la tabla.
+ */
+template <typename T>
+const ModularFactorialTable<T> &modular_factorial_table(T p, std::uint64_t n) {
+  thread_local std::array<ModularFactorialTable<T>, MOD_TABLE_CACHE_SIZE>
+      cache{};
+  thread_local std::size_t next_slot = 0;
+
+  ModularFactorialTable<T> *table = nullptr;
+  for (ModularFactorialTable<T> &entry : cache) {
+    if (entry.modulus == p) {
+      table = &entry;
+      break;
+    }
+  }
+  if (table == nullptr) {
+    // Reemplazo circular: la entrada más antigua
+    table = &cache[next_slot];
+    next_slot = (next_slot + 1) % MOD_TABLE_CACHE_SIZE;
+  }
+
+  const std::uint64_t wanted = n + 1;
+  // Crecemos al menos al doble para amortizar reconstrucciones sucesivas
+  std::size_t entries = table->modulus == p ? table->size() : 0;
+  if (wanted > entries) {
+    entries = wanted > MOD_TABLE_MAX_SIZE / 2 ? MOD_TABLE_MAX_SIZE
+                                              : static_cast<std::size_t>(
+                                                    wanted > 2 * entries
+                                                        ? wanted
+                                                        : 2 * entries);
+  }
+  table->build(p, entries);
+  return *table;
+}
+
+} // namespace numbers_calculations::math::internal
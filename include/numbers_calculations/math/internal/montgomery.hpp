@@ -0,0 +1,308 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: montgomery.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Núcleos de aritmética modular para módulos de 64 y 128 bits que respaldan
+ * `power_mod` y `mul_mod` (ver `math/modular_arith.hpp`) y los tests de
+ * primalidad de `math/primality.hpp`:
+ * - Productos 64x64 -> 128 y 128x128 -> 256 bits (a partir de mitades de
+ *   64 bits, sin tipos de 256 bits).
+ * - Forma de Montgomery (módulos impares).
+ * - Reducción de Barrett (módulos < 2^64, también pares).
+ * - Módulos pares: teorema chino del resto entre Montgomery (parte impar)
+ *   y la aritmética natural módulo 2^s.
+ *
+ * Explicación didáctica:
+ * Reducir a * b mod m con `%` es una división, la operación entera más
+ * lenta (y para 128 bits una llamada a `__umodti3`). Montgomery cambia de
+ * representación: x se guarda como x * R mod m (R = 2^64 o 2^128), y el
+ * producto de dos números en esa forma se reduce con REDC,
+ *
+ *     REDC(T) = (T - m * ((T * m') mod R)) / R     (m' = m^-1 mod R)
+ *
+ * que sólo usa multiplicaciones, sumas y un desplazamiento (dividir por R
+ * es quedarse con la mitad alta). Barrett, en cambio, precalcula
+ * mu = floor(2^128 / m) y estima el cociente con un producto:
+ * q ~ (x * mu) >> 128, corrigiendo después con una o dos restas.
+ *
+ * Todo es `constexpr`: power_mod se puede evaluar en tiempo de compilación.
+ * ==============================================================================
+ */
+
+#include <cstdint> // Para std::uint64_t
+#include <limits>  // Para numeric_limits
+#include <type_traits>
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para uint128_t
+
+namespace numbers_calculations::math::internal {
+
+/**
+ * @brief Resultado de un producto ancho: hi * 2^bits(T) + lo.
+ */
+template <typename T> struct WideProduct {
+  T hi;
+  T lo;
+};
+
+/**
+ * @brief Producto completo a * b (64x64 -> 128 o 128x128 -> 256 bits).
+ *
+ * Para 128 bits se usa el esquema de escuela con mitades de 64 bits:
+ *
+ *     (a1 2^64 + a0)(b1 2^64 + b0) =
+ *         a1 b1 2^128 + (a1 b0 + a0 b1) 2^64 + a0 b0
+ */
+template <typename T>
+constexpr WideProduct<T> wide_mul(T a, T b) noexcept {
+  if constexpr (std::is_same_v<T, std::uint64_t>) {
+    const core::uint128_t p = static_cast<core::uint128_t>(a) * b;
+    return {static_cast<std::uint64_t>(p >> 64),
+            static_cast<std::uint64_t>(p)};
+  } else {
+    const core::uint128_t mask = ~std::uint64_t{0};
+    const core::uint128_t a0 = a & mask, a1 = a >> 64;
+    const core::uint128_t b0 = b & mask, b1 = b >> 64;
+    const core::uint128_t p00 = a0 * b0;
+    const core::uint128_t p01 = a0 * b1;
+    const core::uint128_t p10 = a1 * b0;
+    const core::uint128_t p11 = a1 * b1;
+    // Columna central (hasta 3 * (2^64 - 1), cabe en 128 bits)
+    const core::uint128_t middle = (p00 >> 64) + (p01 & mask) + (p10 & mask);
+    return {p11 + (p01 >> 64) + (p10 >> 64) + (middle >> 64),
+            (middle << 64) | (p00 & mask)};
+  }
+}
+
+/**
+ * @brief (hi * 2^bits + lo) mod m, con hi < m, bit a bit (desplazar y
+ * restar). Sólo fuera de los bucles: R^2 mod m y `mul_mod` de 128 bits.
+ */
+template <typename T>
+constexpr T shift_reduce(T hi, T lo, T m) noexcept {
+  constexpr int bits = std::numeric_limits<T>::digits;
+  T r = hi;
+  for (int i = bits - 1; i >= 0; --i) {
+    const bool top = (r >> (bits - 1)) != 0;
+    r = static_cast<T>((r << 1) | ((lo >> i) & 1));
+    if (top || r >= m) {
+      r -= m;
+    }
+  }
+  return r;
+}
+
+/**
+ * @brief m^-1 mod 2^bits(T) para m impar, por Newton-Hensel: cada paso
+ * duplica los bits correctos (m * m = 1 mod 8 da 3 bits de partida).
+ */
+template <typename T>
+constexpr T inverse_mod_power_of_two(T m) noexcept {
+  T x = m;
+  for (int correct = 3; correct < std::numeric_limits<T>::digits;
+       correct *= 2) {
+    x = static_cast<T>(x * (T{2} - m * x));
+  }
+  return x;
+}
+
+// ==========================================================================
+// Montgomery (módulos impares)
+// ==========================================================================
+
+/**
+ * @brief Contexto de Montgomery para un módulo impar m (T = uint64_t o
+ * uint128_t, R = 2^bits(T)).
+ */
+template <typename T> class MontgomeryContext {
+public:
+  constexpr explicit MontgomeryContext(T m) noexcept
+      : modulus_(m), inverse_(inverse_mod_power_of_two(m)),
+        r1_(static_cast<T>(T{0} - m) % m), r2_(compute_r2(m, r1_)) {}
+
+  constexpr T modulus() const noexcept { return modulus_; }
+
+  // Representación de Montgomery de 1 (R mod m).
+  constexpr T one() const noexcept { return r1_; }
+
+  /**
+   * @brief REDC: (hi * R + lo) * R^-1 mod m, para hi < m.
+   *
+   * Con u = lo * m^-1 mod R, u * m tiene la misma mitad baja que lo, así
+   * que (hi * R + lo - u * m) / R = hi - (u * m).hi, en (-m, m): basta
+   * sumar m si la resta "se pasa". Sin acarreos que seguir.
+   */
+  constexpr T reduce(T hi, T lo) const noexcept {
+    const T u = static_cast<T>(lo * inverse_);
+    const T um_hi = wide_mul(u, modulus_).hi;
+    const T r = static_cast<T>(hi - um_hi);
+    return hi < um_hi ? static_cast<T>(r + modulus_) : r;
+  }
+
+  constexpr T mul(T a, T b) const noexcept {
+    const WideProduct<T> p = wide_mul(a, b);
+    return reduce(p.hi, p.lo);
+  }
+
+  constexpr T to_montgomery(T a) const noexcept {
+    return mul(a % modulus_, r2_);
+  }
+  constexpr T from_montgomery(T a) const noexcept { return reduce(T{0}, a); }
+
+  // Suma, resta y mitad módulo m: valen igual en forma de Montgomery
+  // (son lineales). La suma comprueba el acarreo: para m > 2^(bits-1),
+  // a + b puede no caber en T.
+  constexpr T add(T a, T b) const noexcept {
+    const T r = static_cast<T>(a + b);
+    return (r < a || r >= modulus_) ? static_cast<T>(r - modulus_) : r;
+  }
+  constexpr T sub(T a, T b) const noexcept {
+    return a >= b ? static_cast<T>(a - b) : static_cast<T>(a - b + modulus_);
+  }
+  // a / 2 mod m (m impar): si a es impar, (a + m) / 2 sin desbordar.
+  constexpr T half(T a) const noexcept {
+    return (a & 1) ? static_cast<T>((a >> 1) + (modulus_ >> 1) + 1)
+                   : static_cast<T>(a >> 1);
+  }
+
+  /**
+   * @brief a^exp, con a y el resultado en forma de Montgomery.
+   */
+  template <typename T_Exp> constexpr T pow(T a, T_Exp exp) const noexcept {
+    T result = r1_;
+    while (exp > 0) {
+      if (exp & 1) {
+        result = mul(result, a);
+      }
+      a = mul(a, a);
+      exp >>= 1;
+    }
+    return result;
+  }
+
+private:
+  // R^2 mod m = (R mod m) * R mod m
+  static constexpr T compute_r2(T m, T r1) noexcept {
+    if constexpr (std::is_same_v<T, std::uint64_t>) {
+      return static_cast<T>((static_cast<core::uint128_t>(r1) << 64) % m);
+    } else {
+      return shift_reduce(r1, T{0}, m);
+    }
+  }
+
+  T modulus_;
+  T inverse_;
+  T r1_;
+  T r2_;
+};
+
+/**
+ * @brief base^exp mod m (m impar, m > 1) en forma de Montgomery.
+ */
+template <typename T, typename T_Exp>
+constexpr T montgomery_power(T base, T_Exp exp, T m) noexcept {
+  const MontgomeryContext<T> ctx(m);
+  return ctx.from_montgomery(ctx.pow(ctx.to_montgomery(base), exp));
+}
+
+// ==========================================================================
+// Barrett (módulos < 2^64)
+// ==========================================================================
+
+/**
+ * @brief Contexto de Barrett para 1 < m < 2^64 (cualquier paridad).
+ */
+class BarrettContext {
+public:
+  constexpr explicit BarrettContext(std::uint64_t m) noexcept
+      : modulus_(m), mu_(~core::uint128_t{0} / m) {}
+
+  constexpr std::uint64_t modulus() const noexcept { return modulus_; }
+
+  /**
+   * @brief x mod m para x < m^2 (< 2^128).
+   *
+   * q = (x * mu) >> 128 subestima floor(x / m) en como mucho 2.
+   */
+  constexpr std::uint64_t reduce(core::uint128_t x) const noexcept {
+    const core::uint128_t q = wide_mul(x, mu_).hi;
+    core::uint128_t r = x - q * modulus_;
+    while (r >= modulus_) {
+      r -= modulus_;
+    }
+    return static_cast<std::uint64_t>(r);
+  }
+
+  constexpr std::uint64_t mul(std::uint64_t a, std::uint64_t b) const noexcept {
+    return reduce(static_cast<core::uint128_t>(a) * b);
+  }
+
+private:
+  std::uint64_t modulus_;
+  core::uint128_t mu_;
+};
+
+/**
+ * @brief base^exp mod m (1 < m < 2^64) con reducción de Barrett.
+ */
+template <typename T_Exp>
+constexpr std::uint64_t barrett_power(std::uint64_t base, T_Exp exp,
+                                      std::uint64_t m) noexcept {
+  const BarrettContext ctx(m);
+  std::uint64_t result = 1;
+  std::uint64_t b = base % m;
+  while (exp > 0) {
+    if (exp & 1) {
+      result = ctx.mul(result, b);
+    }
+    b = ctx.mul(b, b);
+    exp >>= 1;
+  }
+  return result;
+}
+
+// ==========================================================================
+// Módulos pares: teorema chino del resto
+// ==========================================================================
+
+/**
+ * @brief base^exp mod m para m par (m = 2^s * q, q impar).
+ *
+ * Módulo 2^s la potencia es la binaria de siempre con productos que
+ * desbordan (la aritmética sin signo ya es módulo 2^bits) y una máscara;
+ * módulo q se usa Montgomery. Las dos partes se combinan con
+ *
+ *     x = x_q + q * ((x_2 - x_q) * q^-1 mod 2^s)      (0 <= x < m)
+ */
+template <typename T, typename T_Exp>
+constexpr T even_power(T base, T_Exp exp, T m) noexcept {
+  int s = 0;
+  T q = m;
+  while ((q & 1) == 0) {
+    q >>= 1;
+    ++s;
+  }
+  const T low_mask = static_cast<T>((T{1} << s) - 1);
+
+  T low = 1;
+  T b = base;
+  for (T_Exp e = exp; e > 0; e >>= 1) {
+    if (e & 1) {
+      low = static_cast<T>(low * b);
+    }
+    b = static_cast<T>(b * b);
+  }
+  low &= low_mask;
+  if (q == 1) {
+    return low;
+  }
+
+  const T high = montgomery_power(base, exp, q);
+  const T t = static_cast<T>((low - high) * inverse_mod_power_of_two(q)) &
+              low_mask;
+  return static_cast<T>(high + q * t);
+}
+
+} // namespace numbers_calculations::math::internal
@@ -0,0 +1,78 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: parallel.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Utilidades mínimas de paralelismo (sólo `std::thread`) para los algoritmos
+ * de la biblioteca que trabajan sobre rangos grandes.
+ *
+ * El reparto es dinámico: el trabajo se divide en más bloques que hilos y
+ * cada hilo toma el siguiente bloque libre de un contador atómico. Así un
+ * hilo que termina pronto sigue "robando" bloques pendientes y no queda
+ * ocioso aunque los bloques tengan costes distintos.
+ * ==============================================================================
+ */
+
+#include <atomic>  // Para std::atomic
+#include <cstddef> // Para std::size_t
+#include <thread>  // Para std::thread
+#include <vector>
+
+namespace numbers_calculations::math::internal {
+
+/**
+ * @brief Traduce el número de hilos pedido (0 = automático) a uno concreto.
+ */
+inline unsigned resolve_thread_count(unsigned requested) noexcept {
+  if (requested != 0) {
+    return requested;
+  }
+  const unsigned hw = std::thread::hardware_concurrency();
+  return hw != 0 ? hw : 1;
+}
+
+/**
+ * @brief Ejecuta `fn(i)` para cada bloque i en [0, chunk_count) usando
+ * hasta `thread_count` hilos (incluido el hilo llamante).
+ *
+ * @param chunk_count Número de bloques de trabajo independientes.
+ * @param thread_count Número de hilos (0 = `hardware_concurrency()`).
+ * @param fn Invocable `void(std::size_t)`. Debe ser seguro llamarlo en
+ * paralelo para índices distintos.
+ */
+template <typename Fn>
+void parallel_for_chunks(std::size_t chunk_count, unsigned thread_count,
+                         Fn &&fn) {
+  unsigned threads = resolve_thread_count(thread_count);
+  if (threads > chunk_count) {
+    threads = static_cast<unsigned>(chunk_count);
+  }
+  if (threads <= 1) {
+    for (std::size_t i = 0; i < chunk_count; ++i) {
+      fn(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next{0};
+  auto worker = [&]() {
+    for (std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+         i < chunk_count; i = next.fetch_add(1, std::memory_order_relaxed)) {
+      fn(i);
+    }
+  };
+
+  std::vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  for (unsigned t = 1; t < threads; ++t) {
+    pool.emplace_back(worker);
+  }
+  worker(); // El hilo llamante también trabaja
+  for (auto &th : pool) {
+    th.join();
+  }
+}
+
+} // namespace numbers_calculations::math::internal
@@ -0,0 +1,296 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: prime_sieve.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Cribas de Eratóstenes (sólo impares) para obtener primos:
+ * - `simple_sieve_primes(n)`: criba clásica de [0, n], para n pequeños.
+ * - `SieveSegment`: criba segmentada por bloques del tamaño de la caché L1;
+ *   es el motor de `primes_in` y `prime_count` (ver `math/primes.hpp`).
+ * - `sieve_primes(n)`: lista de primos <= n (elige una de las dos). La usan
+ *   los algoritmos de factorización del factorial (prime-swing, fórmula de
+ *   Legendre).
+ *
+ * Explicación didáctica:
+ * La criba clásica recorre un array de n / 2 bits una vez por primo; si no
+ * cabe en caché, cada tachado es un fallo de caché. La segmentada criba
+ * [lo, lo + S) con S del tamaño de la L1 (32 KiB = 2^18 impares) usando
+ * sólo los primos <= sqrt(hi), y pasa al segmento siguiente: la memoria
+ * es O(sqrt(hi) + S) y todos los tachados aciertan en caché.
+ *
+ * Además, cada segmento no empieza "a unos", sino con el patrón de la rueda
+ * 3 * 5 * 7 * 11 * 13 ya tachado (periódico: 15015 impares), copiado de 64
+ * en 64 bits. Los primos de la rueda son los que más tachados harían.
+ * ==============================================================================
+ */
+
+#include <array>   // Para el patrón de la rueda
+#include <cmath>   // Para std::log
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint32_t, std::uint64_t
+#include <memory>  // Para std::shared_ptr
+#include <numbers_calculations/math/integer_ops.hpp> // Para trailing_zeros y popcount
+#include <vector>
+
+namespace numbers_calculations::math::internal {
+
+/**
+ * @brief Devuelve todos los primos p <= limit en orden creciente (criba
+ * clásica sobre un único array).
+ *
+ * Sólo se almacenan los impares: el índice i representa al número 2*i + 1,
+ * lo que reduce la memoria a la mitad.
+ *
+ * @param limit Cota superior (incluida). Debe caber en `std::uint32_t`.
+ * @return Un `std::vector<std::uint32_t>` con los primos.
+ *
+ * @test_property simple_sieve_primes(30) == {2, 3, 5, 7, 11, 13, 17, 19, 23, 29}
+ */
+inline std::vector<std::uint32_t> simple_sieve_primes(std::uint32_t limit) {
+  std::vector<std::uint32_t> primes;
+  if (limit < 2) {
+    return primes;
+  }
+  primes.push_back(2);
+
+  const std::uint32_t half = (limit - 1) / 2; // impares 3, 5, ..., <= limit
+  std::vector<bool> composite(half + 1, false);
+
+  for (std::uint64_t i = 1; i <= half; ++i) {
+    if (composite[i]) {
+      continue;
+    }
+    const std::uint64_t p = 2 * i + 1;
+    primes.push_back(static_cast<std::uint32_t>(p));
+    // Tachamos desde p^2, avanzando de 2p en 2p (índice de p en p)
+    for (std::uint64_t j = (p * p - 1) / 2; j <= half; j += p) {
+      composite[j] = true;
+    }
+  }
+  return primes;
+}
+
+// ==========================================================================
+// Criba segmentada
+// ==========================================================================
+
+// Palabras de 64 bits por segmento: 32 KiB (L1), 2^18 impares.
+inline constexpr std::size_t SIEVE_SEGMENT_WORDS = 4096;
+inline constexpr std::uint64_t SIEVE_SEGMENT_BITS = SIEVE_SEGMENT_WORDS * 64;
+
+// Rueda de pre-tachado: 3 * 5 * 7 * 11 * 13 (periodo en índices de impares).
+inline constexpr std::array<std::uint32_t, 5> SIEVE_WHEEL_PRIMES = {3, 5, 7,
+                                                                    11, 13};
+inline constexpr std::uint64_t SIEVE_WHEEL_PERIOD = 15015;
+
+// El patrón se guarda con 128 bits de más para leer 64 bits desde
+// cualquier posición < SIEVE_WHEEL_PERIOD sin dar la vuelta.
+inline constexpr std::size_t SIEVE_WHEEL_WORDS =
+    (SIEVE_WHEEL_PERIOD + 128 + 63) / 64;
+
+constexpr std::array<std::uint64_t, SIEVE_WHEEL_WORDS>
+make_sieve_wheel_pattern() noexcept {
+  std::array<std::uint64_t, SIEVE_WHEEL_WORDS> pattern{};
+  for (std::uint64_t i = 0; i < SIEVE_WHEEL_WORDS * 64; ++i) {
+    const std::uint64_t odd = 2 * (i % SIEVE_WHEEL_PERIOD) + 1;
+    bool candidate = true;
+    for (const std::uint32_t p : SIEVE_WHEEL_PRIMES) {
+      candidate = candidate && odd % p != 0;
+    }
+    if (candidate) {
+      pattern[i / 64] |= std::uint64_t{1} << (i % 64);
+    }
+  }
+  return pattern;
+}
+
+inline constexpr auto SIEVE_WHEEL_PATTERN = make_sieve_wheel_pattern();
+
+/**
+ * @brief Un segmento de la criba: bit i a 1 si el impar
+ * 2 * (first_index() + i) + 1 es primo.
+ *
+ * Guarda, para cada primo base p, el índice del siguiente múltiplo impar
+ * por tachar, de modo que avanzar al segmento contiguo (`advance`) no
+ * necesita ninguna división. Sólo `seek` (saltar a otro sitio) divide,
+ * una vez por primo.
+ */
+class SieveSegment {
+public:
+  /**
+   * @param base_primes Primos (en orden, pueden incluir 2..13) hasta al
+   * menos sqrt del mayor número que se vaya a cribar.
+   * @param first_index Índice de impar (n = 2i + 1) donde empieza.
+   */
+  SieveSegment(std::shared_ptr<const std::vector<std::uint32_t>> base_primes,
+               std::uint64_t first_index)
+      : base_primes_(std::move(base_primes)), words_(SIEVE_SEGMENT_WORDS) {
+    // Primer primo base fuera de la rueda
+    while (first_base_ < base_primes_->size() &&
+           (*base_primes_)[first_base_] <= SIEVE_WHEEL_PRIMES.back()) {
+      ++first_base_;
+    }
+    next_multiple_.resize(base_primes_->size());
+    seek(first_index);
+  }
+
+  std::uint64_t first_index() const noexcept { return first_index_; }
+  const std::vector<std::uint64_t> &words() const noexcept { return words_; }
+
+  // Criba el segmento que empieza en el índice de impar `first_index`.
+  void seek(std::uint64_t first_index) {
+    first_index_ = first_index;
+    active_ = first_base_;
+    sieve();
+  }
+
+  // Criba el segmento siguiente al actual.
+  void advance() {
+    first_index_ += SIEVE_SEGMENT_BITS;
+    sieve();
+  }
+
+  /**
+   * @brief Número de primos impares con índice en [lo, hi) (índices
+   * relativos al segmento, hi <= SIEVE_SEGMENT_BITS).
+   */
+  std::uint64_t count(std::uint64_t lo, std::uint64_t hi) const noexcept {
+    std::uint64_t total = 0;
+    for (std::uint64_t w = lo / 64; w * 64 < hi; ++w) {
+      std::uint64_t bits = words_[w];
+      if (w == lo / 64) {
+        bits &= ~std::uint64_t{0} << (lo % 64);
+      }
+      if ((w + 1) * 64 > hi) {
+        bits &= ~std::uint64_t{0} >> (64 - hi % 64);
+      }
+      total += popcount(bits);
+    }
+    return total;
+  }
+
+private:
+  void sieve() {
+    // 1. Patrón de la rueda, 64 bits cada vez
+    std::uint64_t offset = first_index_ % SIEVE_WHEEL_PERIOD;
+    for (std::uint64_t &word : words_) {
+      const std::size_t w = static_cast<std::size_t>(offset / 64);
+      const unsigned int shift = static_cast<unsigned int>(offset % 64);
+      word = shift == 0 ? SIEVE_WHEEL_PATTERN[w]
+                        : (SIEVE_WHEEL_PATTERN[w] >> shift) |
+                              (SIEVE_WHEEL_PATTERN[w + 1] << (64 - shift));
+      offset += 64;
+      if (offset >= SIEVE_WHEEL_PERIOD) {
+        offset -= SIEVE_WHEEL_PERIOD;
+      }
+    }
+    // El patrón tacha los propios primos de la rueda y no tacha el 1
+    if (first_index_ < SIEVE_WHEEL_PRIMES.back() / 2 + 1) {
+      for (const std::uint32_t p : SIEVE_WHEEL_PRIMES) {
+        const std::uint64_t i = p / 2;
+        if (i >= first_index_) {
+          set_bit(i - first_index_);
+        }
+      }
+      if (first_index_ == 0) {
+        words_[0] &= ~std::uint64_t{1};
+      }
+    }
+
+    // 2. Primos base: los nuevos (p^2 dentro del segmento) se activan
+    const std::uint64_t end_index = first_index_ + SIEVE_SEGMENT_BITS;
+    const std::vector<std::uint32_t> &primes = *base_primes_;
+    while (active_ < primes.size()) {
+      const std::uint64_t p = primes[active_];
+      const std::uint64_t square_index = p * p / 2;
+      if (square_index >= end_index) {
+        break;
+      }
+      // Primer múltiplo impar de p con índice >= first_index_, desde p^2.
+      // Los múltiplos impares de p tienen índices p/2 + k*p.
+      std::uint64_t start = square_index;
+      if (start < first_index_) {
+        const std::uint64_t behind = (first_index_ - square_index) % p;
+        start = first_index_ + (behind == 0 ? 0 : p - behind);
+      }
+      next_multiple_[active_] = start;
+      ++active_;
+    }
+
+    // 3. Tachado, primo a primo, dentro del segmento
+    std::uint64_t *const words = words_.data();
+    for (std::size_t k = first_base_; k < active_; ++k) {
+      const auto p = static_cast<std::uint32_t>(primes[k]);
+      std::uint64_t local = next_multiple_[k] - first_index_;
+      for (; local < SIEVE_SEGMENT_BITS; local += p) {
+        words[local / 64] &= ~(std::uint64_t{1} << (local % 64));
+      }
+      next_multiple_[k] = first_index_ + local;
+    }
+  }
+
+  void set_bit(std::uint64_t i) noexcept {
+    words_[i / 64] |= std::uint64_t{1} << (i % 64);
+  }
+
+  std::shared_ptr<const std::vector<std::uint32_t>> base_primes_;
+  std::vector<std::uint64_t> words_;
+  std::vector<std::uint64_t> next_multiple_;
+  std::uint64_t first_index_ = 0;
+  std::size_t first_base_ = 0; // primer primo base > 13
+  std::size_t active_ = 0;     // primos base con p^2 ya alcanzado
+};
+
+// Por debajo de este límite la criba clásica ya cabe en caché.
+inline constexpr std::uint32_t SEGMENTED_SIEVE_THRESHOLD = 1u << 20;
+
+/**
+ * @brief Devuelve todos los primos p <= limit en orden creciente.
+ *
+ * @param limit Cota superior (incluida). Debe caber en `std::uint32_t`.
+ * @return Un `std::vector<std::uint32_t>` con los primos.
+ *
+ * @test_property sieve_primes(1).empty()
+ * @test_property sieve_primes(30) == {2, 3, 5, 7, 11, 13, 17, 19, 23, 29}
+ *
+ * @optimize_note Para limit >= 2^20 usa la criba segmentada: sin fallos de
+ *                caché en el tachado y con la rueda pre-tachada.
+ */
+inline std::vector<std::uint32_t> sieve_primes(std::uint32_t limit) {
+  if (limit < SEGMENTED_SIEVE_THRESHOLD) {
+    return simple_sieve_primes(limit);
+  }
+  std::uint32_t root = 1;
+  while (static_cast<std::uint64_t>(root + 1) * (root + 1) <= limit) {
+    ++root;
+  }
+  SieveSegment segment(
+      std::make_shared<const std::vector<std::uint32_t>>(
+          simple_sieve_primes(root)),
+      0);
+
+  std::vector<std::uint32_t> primes;
+  // pi(x) < 1.26 x / ln x (Rosser-Schoenfeld)
+  primes.reserve(static_cast<std::size_t>(1.26 * limit / std::log(limit)));
+  primes.push_back(2);
+  const std::uint64_t last_index = (limit - 1) / 2; // índice del mayor impar
+  while (segment.first_index() <= last_index) {
+    const auto &words = segment.words();
+    for (std::size_t w = 0; w < words.size(); ++w) {
+      for (std::uint64_t bits = words[w]; bits != 0; bits &= bits - 1) {
+        const std::uint64_t index =
+            segment.first_index() + w * 64 + trailing_zeros(bits);
+        if (index > last_index) {
+          return primes;
+        }
+        primes.push_back(static_cast<std::uint32_t>(2 * index + 1));
+      }
+    }
+    segment.advance();
+  }
+  return primes;
+}
+
+} // namespace numbers_calculations::math::internal
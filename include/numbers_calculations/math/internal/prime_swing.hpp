@@ -0,0 +1,134 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: prime_swing.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Algoritmo "prime-swing" de Peter Luschny para calcular n! con tipos de
+ * Boost.Multiprecision de ancho arbitrario.
+ *
+ * Explicación didáctica:
+ * Se define el "swing" de n como el cociente
+ *
+ *     n≀ = n! / (floor(n/2)!)^2
+ *
+ * de modo que n! = (floor(n/2)!)^2 * n≀, y basta con recursión sobre n/2.
+ * El exponente del primo p en n≀ es la suma de los bits de paridad
+ *
+ *     e_p(n≀) = sum_i (floor(n / p^i) mod 2),
+ *
+ * de donde se deduce que p^e_p <= n: cada factor primo del swing cabe en una
+ * palabra de máquina. Además los primos en (n/3, n/2] no aparecen y los de
+ * (n/2, n] aparecen exactamente una vez. El swing es, por tanto, un producto
+ * de números pequeños que se evalúa con un árbol de productos balanceado.
+ *
+ * Es el método asintóticamente más rápido conocido para calcular n!.
+ * ==============================================================================
+ */
+
+#include <cstdint> // Para std::uint64_t
+#include <limits>  // Para numeric_limits
+#include <numbers_calculations/core/checked_arith.hpp> // Para checked_mul
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_boost_integer_v
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/integer_roots.hpp> // Para integer_sqrt
+#include <numbers_calculations/math/internal/factorial_lookup_table.hpp> // Para FACTORIALS_LUT
+#include <numbers_calculations/math/internal/prime_sieve.hpp> // Para sieve_primes
+#include <numbers_calculations/math/internal/product_tree.hpp> // Para product_list
+#include <vector>
+
+namespace numbers_calculations::math::internal {
+
+// Por debajo de este n, el árbol de productos directo es más rápido que
+// pagar la criba y la recursión del prime-swing.
+inline constexpr std::uint64_t PRIME_SWING_THRESHOLD = 512;
+
+/**
+ * @brief Calcula el swing n≀ = n! / (floor(n/2)!)^2.
+ *
+ * @param n El número.
+ * @param primes Primos en orden creciente que cubren al menos [2, n].
+ * @param factors Buffer de trabajo reutilizado entre llamadas.
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> prime_swing(std::uint64_t n,
+                              const std::vector<std::uint32_t> &primes,
+                              std::vector<std::uint64_t> &factors) noexcept {
+  const std::uint64_t root = *integer_sqrt(n);
+
+  factors.clear();
+  for (const std::uint64_t p : primes) {
+    if (p > n) {
+      break;
+    }
+    if (p <= root) {
+      // Primos pequeños: acumulamos p^e con e = suma de paridades
+      std::uint64_t power = 1;
+      for (std::uint64_t q = n / p; q > 0; q /= p) {
+        if (q & 1) {
+          power *= p;
+        }
+      }
+      if (power > 1) {
+        factors.push_back(power);
+      }
+    } else if ((n / p) & 1) {
+      // p > sqrt(n): sólo hay un término floor(n/p), exponente 0 ó 1
+      factors.push_back(p);
+    }
+  }
+  return product_list<T>(factors.data(), factors.data() + factors.size());
+}
+
+/**
+ * @brief Recursión n! = (floor(n/2)!)^2 * n≀.
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T>
+prime_swing_factorial_rec(std::uint64_t n,
+                          const std::vector<std::uint32_t> &primes,
+                          std::vector<std::uint64_t> &factors) noexcept {
+  if (n < FACTORIALS_LUT.size()) {
+    return static_cast<T>(FACTORIALS_LUT[static_cast<std::size_t>(n)]);
+  }
+
+  auto half = prime_swing_factorial_rec<T>(n / 2, primes, factors);
+  if (!half) {
+    return half;
+  }
+  auto squared = core::checked_mul(*half, *half);
+  if (!squared) {
+    return squared;
+  }
+  auto swing = prime_swing<T>(n, primes, factors);
+  if (!swing) {
+    return swing;
+  }
+  return core::checked_mul(*squared, *swing);
+}
+
+/**
+ * @brief Calcula n! con el algoritmo prime-swing de Luschny.
+ *
+ * @tparam T Tipo entero de Boost.Multiprecision.
+ * @param n El número (debe caber en `std::uint32_t` para la criba).
+ * @return n! o `MathError::Overflow`.
+ *
+ * @test_property prime_swing_factorial<cpp_int>(n) == product_range(2, n)
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> prime_swing_factorial(std::uint64_t n) noexcept {
+  if (n > std::numeric_limits<std::uint32_t>::max()) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+  const auto primes = sieve_primes(static_cast<std::uint32_t>(n));
+  std::vector<std::uint64_t> factors;
+  factors.reserve(primes.size());
+  return prime_swing_factorial_rec<T>(n, primes, factors);
+}
+
+} // namespace numbers_calculations::math::internal
@@ -0,0 +1,174 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: product_tree.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Implementa el producto de rangos de enteros consecutivos mediante un árbol
+ * de productos balanceado (binary splitting) para tipos de Boost.Multiprecision.
+ *
+ * Explicación didáctica:
+ * Multiplicar 1 * 2 * 3 * ... * n acumulando término a término obliga a
+ * multiplicar un número enorme por uno diminuto en cada paso, con un coste
+ * total cuadrático en el tamaño del resultado. Si en su lugar partimos el
+ * rango por la mitad y multiplicamos recursivamente ambas mitades,
+ *
+ *     prod(lo, hi) = prod(lo, mid) * prod(mid + 1, hi)
+ *
+ * cada multiplicación empareja operandos de tamaño similar, que es justo donde
+ * los algoritmos de Karatsuba / Toom-Cook (cpp_int, GMP) rinden al máximo.
+ *
+ * Las hojas del árbol acumulan varios términos en un `uint64_t` antes de pasar
+ * al tipo multiprecisión, ahorrando la mayoría de las operaciones "bignum".
+ * ==============================================================================
+ */
+
+#include <cstdint> // Para std::uint64_t
+#include <utility> // Para std::move
+#include <numbers_calculations/core/checked_arith.hpp> // Para checked_mul
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_boost_integer_v
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+
+namespace numbers_calculations::math::internal {
+
+// Número de términos a partir del cual se deja de partir el rango.
+inline constexpr std::uint64_t PRODUCT_TREE_LEAF_SIZE = 32;
+
+/**
+ * @brief Producto de los enteros del rango cerrado [lo, hi] (árbol balanceado).
+ *
+ * @tparam T Tipo entero de Boost.Multiprecision.
+ * @param lo Primer término (lo >= 1).
+ * @param hi Último término. Si hi < lo, el producto vacío vale 1.
+ * @return El producto o `MathError::Overflow` si no cabe en T.
+ *
+ * @test_property product_range<cpp_int>(1, n) == factorial(n)
+ * @test_property product_range<cpp_int>(5, 4) == 1
+ *
+ * @optimize_note Las hojas acumulan en `uint64_t` mientras no desborde.
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> product_range(std::uint64_t lo, std::uint64_t hi) noexcept {
+  if (hi < lo) {
+    return T{1};
+  }
+
+  // --- Caso hoja: acumulación en palabra de máquina ---
+  if (hi - lo < PRODUCT_TREE_LEAF_SIZE) {
+    T result{1};
+    std::uint64_t acc = 1;
+    for (std::uint64_t i = lo;; ++i) {
+      std::uint64_t next = 0;
+      if (core::mul_overflow(acc, i, next)) {
+        auto partial = core::checked_mul(result, T{acc});
+        if (!partial) {
+          return partial;
+        }
+        result = std::move(*partial);
+        next = i;
+      }
+      acc = next;
+      if (i == hi) {
+        break;
+      }
+    }
+    return core::checked_mul(result, T{acc});
+  }
+
+  // --- Caso recursivo: partir el rango por la mitad ---
+  const std::uint64_t mid = lo + (hi - lo) / 2;
+  auto left = product_range<T>(lo, mid);
+  if (!left) {
+    return left;
+  }
+  auto right = product_range<T>(mid + 1, hi);
+  if (!right) {
+    return right;
+  }
+  return core::checked_mul(*left, *right);
+}
+
+/**
+ * @brief Producto balanceado de una lista de palabras [first, last).
+ *
+ * Igual que `product_range`, pero los términos vienen dados explícitamente
+ * (por ejemplo, potencias de primos en el algoritmo prime-swing).
+ * Todos los términos deben ser >= 1.
+ *
+ * @tparam T Tipo entero de Boost.Multiprecision.
+ * @return El producto (1 si la lista está vacía) o `MathError::Overflow`.
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> product_list(const std::uint64_t *first,
+                               const std::uint64_t *last) noexcept {
+  const auto count = static_cast<std::uint64_t>(last - first);
+
+  // --- Caso hoja: acumulación en palabra de máquina ---
+  if (count <= PRODUCT_TREE_LEAF_SIZE) {
+    T result{1};
+    std::uint64_t acc = 1;
+    for (; first != last; ++first) {
+      std::uint64_t next = 0;
+      if (core::mul_overflow(acc, *first, next)) {
+        auto partial = core::checked_mul(result, T{acc});
+        if (!partial) {
+          return partial;
+        }
+        result = std::move(*partial);
+        next = *first;
+      }
+      acc = next;
+    }
+    return core::checked_mul(result, T{acc});
+  }
+
+  // --- Caso recursivo: partir la lista por la mitad ---
+  const std::uint64_t *mid = first + count / 2;
+  auto left = product_list<T>(first, mid);
+  if (!left) {
+    return left;
+  }
+  auto right = product_list<T>(mid, last);
+  if (!right) {
+    return right;
+  }
+  return core::checked_mul(*left, *right);
+}
+
+/**
+ * @brief Producto balanceado de una secuencia de valores [first, last).
+ *
+ * Versión general de `product_list` para valores ya convertibles a T
+ * (por ejemplo, productos parciales grandes).
+ *
+ * @tparam T Tipo entero de Boost.Multiprecision.
+ * @tparam It Iterador de acceso aleatorio.
+ * @return El producto (1 si la secuencia está vacía) o `MathError::Overflow`.
+ */
+template <typename T, typename It,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> product_values(It first, It last) noexcept {
+  const auto count = last - first;
+  if (count == 0) {
+    return T{1};
+  }
+  if (count == 1) {
+    return T(*first);
+  }
+
+  const It mid = first + count / 2;
+  auto left = product_values<T>(first, mid);
+  if (!left) {
+    return left;
+  }
+  auto right = product_values<T>(mid, last);
+  if (!right) {
+    return right;
+  }
+  return core::checked_mul(*left, *right);
+}
+
+} // namespace numbers_calculations::math::internal
@@ -0,0 +1,140 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: modular_arith.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Aritmética modular para módulos nativos de hasta 128 bits:
+ * - `mul_mod(a, b, m)`: producto modular sin desbordamiento.
+ * - `power_mod(base, exp, m)`: exponenciación modular.
+ *
+ * Explicación didáctica:
+ * Calcular a^e mod m elevando primero y reduciendo después necesita un
+ * entero de e * bits(a) bits. Reduciendo tras cada producto del método
+ * binario los valores nunca pasan de m^2 (< 2^256 para m < 2^128), pero
+ * cada reducción sería una división. Los núcleos de
+ * `internal/montgomery.hpp` las sustituyen por multiplicaciones:
+ *
+ *     Módulo                | Método
+ *     ----------------------|----------------------------------------
+ *     impar                 | Montgomery (R = 2^64 o 2^128)
+ *     par (2^s * q)         | Montgomery mod q + natural mod 2^s (CRT)
+ *     < 2^64 (alternativa)  | Barrett (mu = floor(2^128 / m))
+ *
+ * Para los tipos de Boost, `boost::multiprecision::powm` ya cubre el caso.
+ * ==============================================================================
+ */
+
+#include <cstdint> // Para std::uint64_t
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para uint128_t
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/internal/montgomery.hpp> // Para MontgomeryContext
+#include <type_traits> // Para std::enable_if_t
+
+namespace numbers_calculations::math {
+
+/**
+ * @brief Reducción usada por `power_mod`.
+ */
+enum class ModularMethod {
+  Automatic,  // Montgomery (m impar) o Montgomery + CRT (m par)
+  Montgomery, // Igual que Automatic
+  Barrett     // Sólo módulos < 2^64 (por encima se usa Automatic)
+};
+
+// Tipos admitidos como módulo (y como exponente): enteros nativos sin signo
+// de hasta 128 bits.
+template <typename T>
+inline constexpr bool is_modular_arith_word_v =
+    std::is_same_v<T, core::uint128_t> ||
+    (std::is_integral_v<T> && std::is_unsigned_v<T> &&
+     !std::is_same_v<T, bool>);
+
+namespace internal {
+
+// Tipo de trabajo: uint64_t para módulos de hasta 64 bits, uint128_t si no.
+template <typename T>
+using modular_work_t =
+    std::conditional_t<(sizeof(T) <= sizeof(std::uint64_t)), std::uint64_t,
+                       core::uint128_t>;
+
+} // namespace internal
+
+/**
+ * @brief Calcula (a * b) mod m.
+ *
+ * @tparam T Entero nativo sin signo de hasta 128 bits.
+ * @return Un `core::Expected<T>`:
+ * - .value() con (a * b) mod m.
+ * - .error() (MathError::DomainError) si m == 0.
+ *
+ * @test_property mul_mod(2^64 - 1, 2^64 - 1, 2^64 - 59) == 3364
+ *
+ * @optimize_note Para m < 2^64 el producto cabe en 128 bits y basta un `%`;
+ *                para 128 bits se reduce el producto de 256 bits bit a bit.
+ *                En bucles, `power_mod` amortiza mucho mejor la reducción.
+ */
+template <typename T, std::enable_if_t<is_modular_arith_word_v<T>, int> = 0>
+constexpr core::Expected<T> mul_mod(T a, T b, T m) noexcept {
+  if (m == 0) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  if constexpr (sizeof(T) <= sizeof(std::uint64_t)) {
+    return static_cast<T>(static_cast<core::uint128_t>(a) * b % m);
+  } else {
+    const internal::WideProduct<T> p = internal::wide_mul(T(a % m), T(b % m));
+    return internal::shift_reduce(p.hi, p.lo, m);
+  }
+}
+
+/**
+ * @brief Calcula (base ^ exp) mod m.
+ *
+ * @tparam T Entero nativo sin signo de hasta 128 bits (base y módulo).
+ * @tparam T_Exp Entero nativo sin signo (exponente).
+ * @param method Reducción a usar; si no aplica al módulo, se usa la
+ *               automática (el resultado no cambia, sólo el coste).
+ * @return Un `core::Expected<T>`:
+ * - .value() con (base ^ exp) mod m (0^0 = 1).
+ * - .error() (MathError::DomainError) si m == 0.
+ *
+ * @test_property power_mod(2, 10, 1000) == 24
+ * @test_property power_mod(a, p - 1, p) == 1 para p primo y a % p != 0
+ * @test_property power_mod(x, e, 1) == 0
+ *
+ * @optimize_note Es `constexpr`: con argumentos constantes se calcula en
+ *                tiempo de compilación. Con exponentes del tamaño del
+ *                módulo, ~1.7x más rápido que reducir con `%` en 64 bits y
+ *                ~8x más rápido que `powm` sobre cpp_int en 128 bits
+ *                (ver benchmarks/bench_power_mod.cpp).
+ */
+template <typename T, typename T_Exp,
+          std::enable_if_t<is_modular_arith_word_v<T> &&
+                               is_modular_arith_word_v<T_Exp>,
+                           int> = 0>
+constexpr core::Expected<T>
+power_mod(T base, T_Exp exp, T m,
+          ModularMethod method = ModularMethod::Automatic) noexcept {
+  using W = internal::modular_work_t<T>;
+  if (m == 0) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  if (m == 1) {
+    return T{0};
+  }
+  const W modulus = m;
+  if (method == ModularMethod::Barrett && modulus <= ~std::uint64_t{0}) {
+    return static_cast<T>(internal::barrett_power(
+        static_cast<std::uint64_t>(base % m), exp,
+        static_cast<std::uint64_t>(m)));
+  }
+  if (modulus % 2 == 1) {
+    return static_cast<T>(
+        internal::montgomery_power(static_cast<W>(base), exp, modulus));
+  }
+  return static_cast<T>(
+      internal::even_power(static_cast<W>(base), exp, modulus));
+}
+
+} // namespace numbers_calculations::math
@@ -0,0 +1,188 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: parallel_product.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Productos y factoriales multihilo para tipos de Boost.Multiprecision.
+ *
+ * Explicación didáctica:
+ * El producto de un rango grande se reparte en bloques; cada hilo calcula
+ * el producto de sus bloques con un árbol balanceado (ver
+ * internal/product_tree.hpp) y luego los productos parciales se combinan
+ * por parejas, nivel a nivel, también en paralelo:
+ *
+ *     [p0 p1 p2 p3 p4 p5 p6 p7]  ->  [p0p1 p2p3 p4p5 p6p7]  ->  ...
+ *
+ * De este modo las multiplicaciones siguen emparejando operandos de tamaño
+ * similar, igual que en la versión secuencial.
+ *
+ * @todo_feature Paralelizar también el swing del algoritmo prime-swing.
+ * ==============================================================================
+ */
+
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t
+#include <iterator> // Para std::iterator_traits
+#include <limits>  // Para numeric_limits
+#include <numbers_calculations/core/checked_arith.hpp> // Para checked_mul
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_boost_integer_v
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/combinatorics.hpp> // Para factorial
+#include <numbers_calculations/math/internal/parallel.hpp> // Para parallel_for_chunks
+#include <numbers_calculations/math/internal/product_tree.hpp> // Para product_range
+#include <vector>
+
+namespace numbers_calculations::math {
+
+/**
+ * @brief Configuración de los algoritmos multihilo.
+ */
+struct ParallelConfig {
+  // Número de hilos a usar (0 = std::thread::hardware_concurrency()).
+  unsigned thread_count = 0;
+  // Por debajo de este número de términos se calcula en serie.
+  std::size_t serial_cutoff = 4096;
+  // Bloques de trabajo por hilo (más bloques = mejor reparto dinámico).
+  unsigned chunks_per_thread = 4;
+};
+
+namespace internal {
+
+/**
+ * @brief Número de bloques en que se divide un rango de `count` términos.
+ */
+inline std::size_t parallel_chunk_count(std::size_t count,
+                                        const ParallelConfig &config) noexcept {
+  const std::size_t threads = resolve_thread_count(config.thread_count);
+  std::size_t chunks =
+      threads * (config.chunks_per_thread != 0 ? config.chunks_per_thread : 1);
+  // Cada bloque debe tener al menos `serial_cutoff / threads` términos
+  const std::size_t min_chunk =
+      config.serial_cutoff / threads != 0 ? config.serial_cutoff / threads : 1;
+  if (chunks > count / min_chunk) {
+    chunks = count / min_chunk;
+  }
+  return chunks != 0 ? chunks : 1;
+}
+
+/**
+ * @brief Combina productos parciales por parejas, nivel a nivel, en paralelo.
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> parallel_merge(std::vector<core::Expected<T>> partials,
+                                 unsigned thread_count) noexcept {
+  for (const auto &p : partials) {
+    if (!p) {
+      return p;
+    }
+  }
+
+  while (partials.size() > 1) {
+    std::vector<core::Expected<T>> next((partials.size() + 1) / 2);
+    parallel_for_chunks(next.size(), thread_count, [&](std::size_t i) {
+      if (2 * i + 1 < partials.size()) {
+        next[i] = core::checked_mul(*partials[2 * i], *partials[2 * i + 1]);
+      } else {
+        next[i] = std::move(partials[2 * i]);
+      }
+    });
+    for (const auto &p : next) {
+      if (!p) {
+        return p;
+      }
+    }
+    partials = std::move(next);
+  }
+  return partials.empty() ? core::Expected<T>(T{1}) : std::move(partials[0]);
+}
+
+/**
+ * @brief Producto multihilo del rango cerrado de enteros [lo, hi].
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> parallel_product_range(std::uint64_t lo, std::uint64_t hi,
+                                         const ParallelConfig &config) noexcept {
+  if (hi < lo) {
+    return T{1};
+  }
+  const std::uint64_t count = hi - lo + 1;
+  if (count < config.serial_cutoff || resolve_thread_count(config.thread_count) == 1) {
+    return product_range<T>(lo, hi);
+  }
+
+  const std::size_t chunks = parallel_chunk_count(count, config);
+  std::vector<core::Expected<T>> partials(chunks);
+  parallel_for_chunks(chunks, config.thread_count, [&](std::size_t i) {
+    const std::uint64_t first = lo + count * i / chunks;
+    const std::uint64_t last = lo + count * (i + 1) / chunks; // exclusivo
+    partials[i] = product_range<T>(first, last - 1);
+  });
+  return parallel_merge<T>(std::move(partials), config.thread_count);
+}
+
+} // namespace internal
+
+/**
+ * @brief Calcula en paralelo el producto de los valores de [first, last).
+ *
+ * @tparam It Iterador de acceso aleatorio.
+ * @tparam T Tipo entero de Boost.Multiprecision del resultado (por defecto,
+ * el tipo de valor del iterador).
+ * @param first, last Rango de valores a multiplicar.
+ * @param config Número de hilos y umbral para el cálculo en serie.
+ * @return El producto (1 si el rango está vacío) o `MathError::Overflow`.
+ *
+ * @test_property parallel_product(v.begin(), v.end()) ==
+ *                product_values(v.begin(), v.end())
+ */
+template <typename It,
+          typename T = typename std::iterator_traits<It>::value_type,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T> parallel_product(It first, It last,
+                                   const ParallelConfig &config = {}) noexcept {
+  const auto count = static_cast<std::size_t>(last - first);
+  if (count < config.serial_cutoff) {
+    return internal::product_values<T>(first, last);
+  }
+
+  const std::size_t chunks = internal::parallel_chunk_count(count, config);
+  std::vector<core::Expected<T>> partials(chunks);
+  internal::parallel_for_chunks(chunks, config.thread_count, [&](std::size_t i) {
+    partials[i] = internal::product_values<T>(first + count * i / chunks,
+                                              first + count * (i + 1) / chunks);
+  });
+  return internal::parallel_merge<T>(std::move(partials), config.thread_count);
+}
+
+/**
+ * @brief Calcula el factorial (n!) repartiendo el trabajo entre varios hilos.
+ *
+ * Para tipos de Boost con n >= `config.serial_cutoff` divide [2, n] en
+ * bloques que se multiplican en paralelo. En cualquier otro caso delega en
+ * `factorial(n)`.
+ *
+ * @param n El número (debe ser no negativo).
+ * @param config Número de hilos y umbral para el cálculo en serie.
+ * @return Igual que `factorial(n)`.
+ *
+ * @test_property factorial(n, config) == factorial(n)
+ */
+template <typename T,
+          std::enable_if_t<
+              numbers_calculations::core::is_supported_integer_v<T>, int> = 0>
+core::Expected<T> factorial(T n, const ParallelConfig &config) noexcept {
+  if constexpr (core::is_boost_integer_v<T>) {
+    if (n >= 0 && n >= config.serial_cutoff &&
+        n <= std::numeric_limits<std::uint64_t>::max()) {
+      return internal::parallel_product_range<T>(
+          2, static_cast<std::uint64_t>(n), config);
+    }
+  }
+  return factorial(n);
+}
+
+} // namespace numbers_calculations::math
@@ -0,0 +1,408 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: primality.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Test de primalidad determinista para enteros nativos de hasta 128 bits:
+ * - `is_prime(n)`: división por primos pequeños + Miller-Rabin (64 bits)
+ *   o BPSW (128 bits).
+ * - `is_prime_batch`: la misma comprobación sobre columnas de valores,
+ *   repartida entre hilos.
+ *
+ * Explicación didáctica:
+ * Miller-Rabin escribe n - 1 = d * 2^s (d impar) y comprueba, para una
+ * base a, que a^d = 1 o a^(d 2^r) = -1 (mod n) para algún r < s. Todo
+ * primo pasa; un compuesto engaña como mucho a 1/4 de las bases. Para
+ * n < 2^64 se conocen conjuntos de bases que no engaña ningún compuesto:
+ *
+ *     n < 4 759 123 141  ->  {2, 7, 61}                  (Jaeschke)
+ *     n < 2^64           ->  {2, 325, 9375, 28178, 450775,
+ *                             9780504, 1795265022}       (Sinclair)
+ *
+ * Por encima de 2^64 no hay conjuntos probados, así que se usa BPSW:
+ * Miller-Rabin en base 2 más un test fuerte de Lucas (parámetros de
+ * Selfridge). Los pseudoprimos de ambos tests parecen no coincidir nunca:
+ * no se conoce ningún compuesto que pase los dos, y está comprobado que
+ * no hay ninguno por debajo de 2^64.
+ *
+ * Las potencias modulares se hacen en forma de Montgomery
+ * (`internal/montgomery.hpp`): ninguna división de 128 bits en los bucles.
+ * Antes, la división por los primos < 256 descarta ~90 % de los compuestos
+ * con un producto por primo: p divide a n si y sólo si
+ * n * p^-1 mod 2^bits <= (2^bits - 1) / p.
+ * ==============================================================================
+ */
+
+#include <array>   // Para las tablas de divisibilidad
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint64_t, std::int64_t
+#include <limits>  // Para numeric_limits
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para uint128_t y HAS_CPP20_SPAN
+#include <numbers_calculations/math/integer_ops.hpp> // Para integer_log2 y trailing_zeros
+#include <numbers_calculations/math/integer_roots.hpp> // Para integer_sqrt
+#include <numbers_calculations/math/internal/montgomery.hpp> // Para MontgomeryContext
+#include <numbers_calculations/math/internal/parallel.hpp> // Para parallel_for_chunks
+#include <numbers_calculations/math/parallel_product.hpp> // Para ParallelConfig
+#include <type_traits>
+#include <vector>
+
+namespace numbers_calculations::math {
+
+// Tipos admitidos: enteros nativos (con o sin signo) de hasta 128 bits.
+template <typename T>
+inline constexpr bool is_primality_word_v =
+    core::is_native_int128_v<T> ||
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>);
+
+namespace internal {
+
+// Los primos impares menores que este límite se prueban por división.
+inline constexpr unsigned int TRIAL_DIVISION_LIMIT = 256;
+
+// Por debajo de este valor bastan las bases {2, 7, 61} (Jaeschke).
+inline constexpr std::uint64_t MILLER_RABIN_SMALL_BOUND = 4759123141ULL;
+
+inline constexpr std::array<std::uint64_t, 3> MILLER_RABIN_SMALL_BASES = {
+    2, 7, 61};
+inline constexpr std::array<std::uint64_t, 7> MILLER_RABIN_64_BASES = {
+    2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+
+/**
+ * @brief Prueba de divisibilidad por un primo impar p sin dividir:
+ * p | n  <=>  n * inverse (mod 2^bits) <= limit.
+ */
+template <typename U> struct DivisibilityTest {
+  U prime;
+  U inverse; // p^-1 mod 2^bits
+  U limit;   // (2^bits - 1) / p
+};
+
+// Número de primos impares < TRIAL_DIVISION_LIMIT.
+constexpr std::size_t count_odd_primes_below(unsigned int limit) noexcept {
+  std::size_t count = 0;
+  for (unsigned int n = 3; n < limit; n += 2) {
+    bool prime = true;
+    for (unsigned int d = 3; d * d <= n && prime; d += 2) {
+      prime = n % d != 0;
+    }
+    count += prime;
+  }
+  return count;
+}
+
+inline constexpr std::size_t TRIAL_DIVISION_PRIME_COUNT =
+    count_odd_primes_below(TRIAL_DIVISION_LIMIT);
+
+template <typename U>
+constexpr std::array<DivisibilityTest<U>, TRIAL_DIVISION_PRIME_COUNT>
+make_trial_division_tests() noexcept {
+  std::array<DivisibilityTest<U>, TRIAL_DIVISION_PRIME_COUNT> tests{};
+  std::size_t i = 0;
+  for (unsigned int n = 3; n < TRIAL_DIVISION_LIMIT; n += 2) {
+    bool prime = true;
+    for (unsigned int d = 3; d * d <= n && prime; d += 2) {
+      prime = n % d != 0;
+    }
+    if (prime) {
+      const U p = n;
+      tests[i++] = {p, inverse_mod_power_of_two(p),
+                    static_cast<U>(std::numeric_limits<U>::max() / p)};
+    }
+  }
+  return tests;
+}
+
+template <typename U>
+inline constexpr auto TRIAL_DIVISION_TESTS = make_trial_division_tests<U>();
+
+enum class TrialDivision { Composite, Prime, Unknown };
+
+/**
+ * @brief División por los primos impares < TRIAL_DIVISION_LIMIT (n impar,
+ * n > 1). Decide del todo si n < TRIAL_DIVISION_LIMIT^2.
+ */
+template <typename U>
+constexpr TrialDivision trial_division(U n) noexcept {
+  for (const auto &test : TRIAL_DIVISION_TESTS<U>) {
+    if (test.prime * test.prime > n) {
+      return TrialDivision::Prime;
+    }
+    if (static_cast<U>(n * test.inverse) <= test.limit) {
+      return n == test.prime ? TrialDivision::Prime : TrialDivision::Composite;
+    }
+  }
+  return TrialDivision::Unknown;
+}
+
+/**
+ * @brief Miller-Rabin fuerte en una base (n impar, n - 1 = d * 2^s).
+ */
+template <typename U>
+constexpr bool is_strong_probable_prime(const MontgomeryContext<U> &ctx,
+                                        U base, U d, unsigned int s) noexcept {
+  const U n = ctx.modulus();
+  const U a = base % n;
+  if (a == 0) {
+    return true; // La base no aporta información
+  }
+  const U minus_one = static_cast<U>(n - ctx.one());
+  U x = ctx.pow(ctx.to_montgomery(a), d);
+  if (x == ctx.one() || x == minus_one) {
+    return true;
+  }
+  for (unsigned int r = 1; r < s; ++r) {
+    x = ctx.mul(x, x);
+    if (x == minus_one) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Miller-Rabin determinista para n < 2^64 (n impar, sin factores
+ * primos < TRIAL_DIVISION_LIMIT).
+ */
+constexpr bool miller_rabin_64(std::uint64_t n) noexcept {
+  const MontgomeryContext<std::uint64_t> ctx(n);
+  const unsigned int s = trailing_zeros(n - 1);
+  const std::uint64_t d = (n - 1) >> s;
+  if (n < MILLER_RABIN_SMALL_BOUND) {
+    for (const std::uint64_t base : MILLER_RABIN_SMALL_BASES) {
+      if (!is_strong_probable_prime(ctx, base, d, s)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  for (const std::uint64_t base : MILLER_RABIN_64_BASES) {
+    if (!is_strong_probable_prime(ctx, base, d, s)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Símbolo de Jacobi (a / n) para n impar.
+ */
+template <typename U> constexpr int jacobi_symbol(U a, U n) noexcept {
+  int result = 1;
+  a %= n;
+  while (a != 0) {
+    const unsigned int zeros = trailing_zeros(a);
+    a >>= zeros;
+    const unsigned int n_mod_8 = static_cast<unsigned int>(n & 7);
+    if ((zeros & 1) && (n_mod_8 == 3 || n_mod_8 == 5)) {
+      result = -result; // (2 / n) = -1 si n = 3, 5 (mod 8)
+    }
+    if ((a & 3) == 3 && (n & 3) == 3) {
+      result = -result; // Reciprocidad cuadrática
+    }
+    const U t = a;
+    a = static_cast<U>(n % a);
+    n = t;
+  }
+  return n == 1 ? result : 0;
+}
+
+/**
+ * @brief x mod n en forma de Montgomery, para |x| < n con signo.
+ */
+template <typename U>
+constexpr U signed_to_montgomery(const MontgomeryContext<U> &ctx,
+                                 std::int64_t x) noexcept {
+  const U magnitude = static_cast<U>(x < 0 ? -static_cast<std::uint64_t>(x)
+                                           : static_cast<std::uint64_t>(x));
+  const U m = ctx.to_montgomery(magnitude);
+  return x < 0 ? ctx.sub(U{0}, m) : m;
+}
+
+/**
+ * @brief Test fuerte de Lucas con los parámetros de Selfridge (n impar,
+ * no cuadrado, sin factores primos pequeños).
+ *
+ * D es el primero de 5, -7, 9, -11, ... con (D / n) = -1, P = 1 y
+ * Q = (1 - D) / 4. Con n + 1 = d * 2^s, n pasa si U_d = 0 o
+ * V_(d 2^r) = 0 para algún r < s. Las sucesiones se recorren de
+ * izquierda a derecha sobre los bits de d:
+ *
+ *     U_2k = U_k V_k               U_(k+1) = (P U_k + V_k) / 2
+ *     V_2k = V_k^2 - 2 Q^k         V_(k+1) = (D U_k + P V_k) / 2
+ */
+template <typename U>
+constexpr bool is_strong_lucas_probable_prime(
+    const MontgomeryContext<U> &ctx) noexcept {
+  const U n = ctx.modulus();
+  std::int64_t D = 5;
+  for (;;) {
+    const U magnitude = static_cast<U>(D < 0 ? -D : D);
+    int j = jacobi_symbol(magnitude, n);
+    if (D < 0 && (n & 3) == 3) {
+      j = -j; // (-1 / n) = -1 si n = 3 (mod 4)
+    }
+    if (j == -1) {
+      break;
+    }
+    if (j == 0) {
+      return false; // |D| < n comparte un factor con n
+    }
+    D = D < 0 ? 2 - D : -(D + 2);
+  }
+  const std::int64_t Q = (1 - D) / 4;
+
+  const U mont_D = signed_to_montgomery(ctx, D);
+  const U mont_Q = signed_to_montgomery(ctx, Q);
+  // n + 1 no desborda: 2^bits - 1 es múltiplo de 3
+  const U n_plus_one = static_cast<U>(n + 1);
+  const unsigned int s = trailing_zeros(n_plus_one);
+  const U d = static_cast<U>(n_plus_one >> s);
+
+  U u = ctx.one();  // U_1
+  U v = ctx.one();  // V_1 = P
+  U qk = mont_Q;    // Q^1
+  for (int bit = static_cast<int>(*integer_log2(d)) - 1; bit >= 0; --bit) {
+    u = ctx.mul(u, v);
+    v = ctx.sub(ctx.mul(v, v), ctx.add(qk, qk));
+    qk = ctx.mul(qk, qk);
+    if ((d >> bit) & 1) {
+      const U next_u = ctx.half(ctx.add(u, v));
+      v = ctx.half(ctx.add(ctx.mul(mont_D, u), v));
+      u = next_u;
+      qk = ctx.mul(qk, mont_Q);
+    }
+  }
+  if (u == 0 || v == 0) {
+    return true;
+  }
+  for (unsigned int r = 1; r < s; ++r) {
+    v = ctx.sub(ctx.mul(v, v), ctx.add(qk, qk));
+    if (v == 0) {
+      return true;
+    }
+    qk = ctx.mul(qk, qk);
+  }
+  return false;
+}
+
+/**
+ * @brief BPSW: Miller-Rabin en base 2 + Lucas fuerte (n impar, sin
+ * factores primos pequeños).
+ */
+constexpr bool baillie_psw(core::uint128_t n) noexcept {
+  const MontgomeryContext<core::uint128_t> ctx(n);
+  const unsigned int s = trailing_zeros(n - 1);
+  if (!is_strong_probable_prime(ctx, core::uint128_t{2}, (n - 1) >> s, s)) {
+    return false;
+  }
+  // Para un cuadrado perfecto (D / n) nunca vale -1
+  const core::uint128_t root = *integer_sqrt(n);
+  if (root * root == n) {
+    return false;
+  }
+  return is_strong_lucas_probable_prime(ctx);
+}
+
+} // namespace internal
+
+/**
+ * @brief Indica si n es primo.
+ *
+ * @tparam T Entero nativo de hasta 128 bits (con o sin signo; los negativos
+ * no son primos).
+ *
+ * @test_property is_prime(2) == true
+ * @test_property is_prime(561) == false (número de Carmichael)
+ * @test_property is_prime(2^64 - 59) == true
+ * @test_property is_prime(2^127 - 1) == true
+ *
+ * @optimize_note Determinista en todo el rango de 64 bits (Miller-Rabin con
+ *                las bases de Sinclair); para 128 bits usa BPSW, sin
+ *                contraejemplos conocidos. Es `constexpr`.
+ */
+template <typename T, std::enable_if_t<is_primality_word_v<T>, int> = 0>
+constexpr bool is_prime(T n) noexcept {
+  if constexpr (core::is_signed_v<T>) {
+    if (n < 0) {
+      return false;
+    }
+  }
+  using U = typename internal::unsigned_counterpart<T>::type;
+  const U magnitude = static_cast<U>(n);
+  if (magnitude < 2) {
+    return false;
+  }
+  if ((magnitude & 1) == 0) {
+    return magnitude == 2;
+  }
+
+  if (magnitude <= std::numeric_limits<std::uint64_t>::max()) {
+    const auto small = static_cast<std::uint64_t>(magnitude);
+    const auto trial = internal::trial_division(small);
+    if (trial != internal::TrialDivision::Unknown) {
+      return trial == internal::TrialDivision::Prime;
+    }
+    return internal::miller_rabin_64(small);
+  } else {
+    const auto wide = static_cast<core::uint128_t>(magnitude);
+    const auto trial = internal::trial_division(wide);
+    if (trial != internal::TrialDivision::Unknown) {
+      return trial == internal::TrialDivision::Prime;
+    }
+    return internal::baillie_psw(wide);
+  }
+}
+
+/**
+ * @brief Aplica `is_prime` a n[0..count) y escribe el resultado en out,
+ * repartiendo los elementos entre hilos.
+ *
+ * @param config Número de hilos y umbral para el cálculo en serie
+ *               (en elementos).
+ * @return Número de primos encontrados.
+ *
+ * @test_property is_prime_batch(n, count, out)[i] == is_prime(n[i])
+ *
+ * @optimize_note El coste por elemento varía mucho (un compuesto con un
+ *                factor pequeño sale tras la división; un primo hace todas
+ *                las bases), de ahí el reparto dinámico en bloques.
+ */
+template <typename T, std::enable_if_t<is_primality_word_v<T>, int> = 0>
+std::size_t is_prime_batch(const T *n, std::size_t count, bool *out,
+                           const ParallelConfig &config = {}) noexcept {
+  const auto run = [&](std::size_t first, std::size_t last) {
+    std::size_t primes = 0;
+    for (std::size_t i = first; i < last; ++i) {
+      out[i] = is_prime(n[i]);
+      primes += out[i];
+    }
+    return primes;
+  };
+  if (count < config.serial_cutoff) {
+    return run(0, count);
+  }
+
+  const std::size_t chunks = internal::parallel_chunk_count(count, config);
+  std::vector<std::size_t> partials(chunks, 0);
+  internal::parallel_for_chunks(chunks, config.thread_count, [&](std::size_t c) {
+    partials[c] = run(count * c / chunks, count * (c + 1) / chunks);
+  });
+  std::size_t primes = 0;
+  for (const std::size_t partial : partials) {
+    primes += partial;
+  }
+  return primes;
+}
+
+#if HAS_CPP20_SPAN
+// Sobrecarga con std::span (C++20): is_prime_batch<std::uint64_t>(n, out)
+template <typename T, std::enable_if_t<is_primality_word_v<T>, int> = 0>
+std::size_t is_prime_batch(std::span<const T> n, std::span<bool> out,
+                           const ParallelConfig &config = {}) noexcept {
+  return is_prime_batch(n.data(), n.size(), out.data(), config);
+}
+#endif // HAS_CPP20_SPAN
+
+} // namespace numbers_calculations::math
@@ -0,0 +1,197 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: prime_exponents.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Representación de enteros como vector de exponentes primos
+ * (n = p1^e1 * p2^e2 * ...), y en particular la factorización de n!
+ * mediante la fórmula de Legendre.
+ *
+ * Explicación didáctica (fórmula de Legendre):
+ * El exponente del primo p en n! es
+ *
+ *     e_p(n!) = floor(n/p) + floor(n/p^2) + floor(n/p^3) + ...
+ *
+ * porque floor(n/p) términos del producto 1*2*...*n son múltiplos de p,
+ * floor(n/p^2) aportan un segundo factor p, y así sucesivamente.
+ *
+ * Esta representación es exacta y barata de manipular (productos y cocientes
+ * son sumas y restas de exponentes), ideal para aritmética racional exacta.
+ *
+ * Explicación didáctica (teorema de Kummer):
+ * El exponente del primo p en C(n, k) es el número de acarreos que se
+ * producen al sumar k y n - k escritos en base p. Equivale a
+ * e_p(n!) - e_p(k!) - e_p((n-k)!), pero sin calcular los tres términos.
+ *
+ * @todo_feature Operaciones aritméticas (producto, cociente) entre vectores.
+ * ==============================================================================
+ */
+
+#include <cstdint> // Para std::uint64_t
+#include <limits>  // Para numeric_limits
+#include <numbers_calculations/core/checked_arith.hpp> // Para checked_mul
+#include <numbers_calculations/core/extended_type_traits.hpp> // Para is_boost_integer_v
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/internal/prime_sieve.hpp> // Para sieve_primes
+#include <numbers_calculations/math/internal/product_tree.hpp> // Para product_list
+#include <vector>
+
+namespace numbers_calculations::math {
+
+/**
+ * @brief Un factor primo con su exponente (p^e).
+ */
+struct PrimePower {
+  std::uint64_t prime;
+  std::uint64_t exponent;
+};
+
+/**
+ * @brief Factoriza n! como vector de exponentes primos (fórmula de Legendre).
+ *
+ * @param n El número (debe caber en `std::uint32_t` para la criba).
+ * @return Un `core::Expected<std::vector<PrimePower>>`, ordenado por primo:
+ * - .value() con los pares (p, e_p(n!)) para todo primo p <= n.
+ * - .error() (MathError::Overflow) si n no cabe en `std::uint32_t`.
+ *
+ * @test_property factorial_prime_exponents(0).empty()
+ * @test_property factorial_prime_exponents(10) == {(2,8), (3,4), (5,2), (7,1)}
+ */
+inline core::Expected<std::vector<PrimePower>>
+factorial_prime_exponents(std::uint64_t n) noexcept {
+  if (n > std::numeric_limits<std::uint32_t>::max()) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+
+  const auto primes = internal::sieve_primes(static_cast<std::uint32_t>(n));
+  std::vector<PrimePower> factors;
+  factors.reserve(primes.size());
+
+  for (const std::uint64_t p : primes) {
+    std::uint64_t exponent = 0;
+    for (std::uint64_t q = n / p; q > 0; q /= p) {
+      exponent += q;
+    }
+    factors.push_back({p, exponent});
+  }
+  return factors;
+}
+
+/**
+ * @brief Factoriza C(n, k) como vector de exponentes primos (Kummer).
+ *
+ * @param n Número total de elementos (debe caber en `std::uint32_t`).
+ * @param k Número de elementos a elegir.
+ * @return Un `core::Expected<std::vector<PrimePower>>`, ordenado por primo
+ * y sin exponentes nulos:
+ * - .error() (MathError::DomainError) si k > n.
+ * - .error() (MathError::Overflow) si n no cabe en `std::uint32_t`.
+ *
+ * @test_property binomial_prime_exponents(10, 3) == {(2,3), (3,1), (5,1)}
+ * @test_property binomial_prime_exponents(n, 0).empty()
+ */
+inline core::Expected<std::vector<PrimePower>>
+binomial_prime_exponents(std::uint64_t n, std::uint64_t k) noexcept {
+  if (k > n) {
+    return core::Unexpected(core::MathError::DomainError);
+  }
+  if (n > std::numeric_limits<std::uint32_t>::max()) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+
+  const std::uint64_t r = n - k;
+  std::vector<PrimePower> factors;
+  if (k == 0 || r == 0) {
+    return factors;
+  }
+
+  const auto primes = internal::sieve_primes(static_cast<std::uint32_t>(n));
+  for (const std::uint64_t p : primes) {
+    // Contamos los acarreos de k + r en base p
+    std::uint64_t exponent = 0;
+    std::uint64_t carry = 0;
+    for (std::uint64_t a = k, b = r; a > 0 || b > 0; a /= p, b /= p) {
+      carry = (a % p + b % p + carry) >= p ? 1 : 0;
+      exponent += carry;
+    }
+    if (exponent != 0) {
+      factors.push_back({p, exponent});
+    }
+  }
+  return factors;
+}
+
+/**
+ * @brief Reconstruye el entero p1^e1 * p2^e2 * ... en el tipo T.
+ *
+ * Usa exponenciación por cuadrados "agrupada": se recorren los bits de los
+ * exponentes de mayor a menor; en cada paso se eleva al cuadrado el
+ * acumulado y se multiplica por el producto (árbol balanceado) de los primos
+ * cuyo exponente tiene ese bit activo.
+ *
+ *     result = (...((P_k)^2 * P_{k-1})^2 * ...)^2 * P_0
+ *
+ * Así cada primo sólo se multiplica una vez por bit, y las multiplicaciones
+ * caras son cuadrados de números grandes.
+ *
+ * @tparam T Tipo entero de Boost.Multiprecision.
+ * @param factors Pares (primo, exponente). Los primos deben caber en 64 bits.
+ * @return El producto o `MathError::Overflow` si no cabe en T.
+ *
+ * @test_property evaluate_prime_exponents<cpp_int>({}) == 1
+ * @test_property evaluate_prime_exponents<cpp_int>(
+ *                    factorial_prime_exponents(n)) == factorial(n)
+ */
+template <typename T,
+          std::enable_if_t<core::is_boost_integer_v<T>, int> = 0>
+core::Expected<T>
+evaluate_prime_exponents(const std::vector<PrimePower> &factors) noexcept {
+  std::uint64_t max_exponent = 0;
+  for (const auto &f : factors) {
+    max_exponent = f.exponent > max_exponent ? f.exponent : max_exponent;
+  }
+  if (max_exponent == 0) {
+    return T{1};
+  }
+
+  int top_bit = 63;
+  while (((max_exponent >> top_bit) & 1) == 0) {
+    --top_bit;
+  }
+
+  T result{1};
+  std::vector<std::uint64_t> selected;
+  selected.reserve(factors.size());
+
+  for (int bit = top_bit; bit >= 0; --bit) {
+    if (bit != top_bit) {
+      auto squared = core::checked_mul(result, result);
+      if (!squared) {
+        return squared;
+      }
+      result = std::move(*squared);
+    }
+
+    selected.clear();
+    for (const auto &f : factors) {
+      if ((f.exponent >> bit) & 1) {
+        selected.push_back(f.prime);
+      }
+    }
+    auto block = internal::product_list<T>(selected.data(),
+                                           selected.data() + selected.size());
+    if (!block) {
+      return block;
+    }
+    auto next = core::checked_mul(result, *block);
+    if (!next) {
+      return next;
+    }
+    result = std::move(*next);
+  }
+  return result;
+}
+
+} // namespace numbers_calculations::math
@@ -0,0 +1,251 @@
+#pragma once
+
+/* ==============================================================================
+ * Archivo: primes.hpp
+ * Autor:   Gemini
+ *
+ * Objetivo:
+ * Enumeración y recuento de primos con la criba segmentada de
+ * `internal/prime_sieve.hpp`:
+ * - `primes_in(lo, hi)`: rango "perezoso" con los primos de [lo, hi],
+ *   generados segmento a segmento (memoria O(sqrt(hi)), no O(hi - lo)).
+ * - `prime_count(n)`: pi(n), el número de primos <= n, repartiendo los
+ *   segmentos entre hilos.
+ *
+ * Explicación didáctica:
+ * Para cribar [lo, hi] sólo hacen falta los primos <= sqrt(hi): con
+ * hi = 10^12 son 78 498 primos, y cada segmento ocupa 32 KiB. Cada hilo
+ * criba un tramo contiguo de segmentos con su propio segmento y su propia
+ * lista de "siguiente múltiplo" por primo, así que no comparten nada
+ * salvo la lista (de sólo lectura) de primos base. Contar es sumar
+ * `popcount` de las palabras del segmento.
+ * ==============================================================================
+ */
+
+#include <cstddef>  // Para std::size_t
+#include <cstdint>  // Para std::uint64_t
+#include <iterator> // Para std::input_iterator_tag
+#include <memory>   // Para std::shared_ptr
+#include <numbers_calculations/core/math_errors.hpp> // Para Expected y MathError
+#include <numbers_calculations/math/integer_ops.hpp> // Para trailing_zeros
+#include <numbers_calculations/math/integer_roots.hpp> // Para integer_sqrt
+#include <numbers_calculations/math/internal/parallel.hpp> // Para parallel_for_chunks
+#include <numbers_calculations/math/internal/prime_sieve.hpp> // Para SieveSegment
+#include <numbers_calculations/math/parallel_product.hpp> // Para ParallelConfig
+#include <optional> // Para el segmento diferido
+#include <vector>
+
+namespace numbers_calculations::math {
+
+// Mayor cota admitida por `primes_in` y `prime_count` (~1.1 * 10^15): los
+// primos base (<= 2^25) ocupan ~8 MB.
+inline constexpr std::uint64_t SEGMENTED_SIEVE_MAX_LIMIT = std::uint64_t{1}
+                                                           << 50;
+
+namespace internal {
+
+// Primos base <= sqrt(hi), compartidos (sólo lectura) entre segmentos.
+inline std::shared_ptr<const std::vector<std::uint32_t>>
+sieve_base_primes(std::uint64_t hi) {
+  return std::make_shared<const std::vector<std::uint32_t>>(
+      sieve_primes(static_cast<std::uint32_t>(*integer_sqrt(hi))));
+}
+
+} // namespace internal
+
+/**
+ * @brief Primos de [lo, hi] en orden creciente, generados bajo demanda.
+ *
+ * Es un rango de un solo recorrido (como `std::istream_iterator`): los
+ * iteradores apuntan al estado del propio rango, que no debe moverse
+ * mientras se recorre.
+ */
+class PrimeRange {
+public:
+  class iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::uint64_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::uint64_t *;
+    using reference = const std::uint64_t &;
+
+    iterator() = default;
+
+    reference operator*() const noexcept { return range_->current_; }
+    iterator &operator++() {
+      if (!range_->next()) {
+        range_ = nullptr;
+      }
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+
+    friend bool operator==(const iterator &a, const iterator &b) noexcept {
+      return a.range_ == b.range_;
+    }
+    friend bool operator!=(const iterator &a, const iterator &b) noexcept {
+      return a.range_ != b.range_;
+    }
+
+  private:
+    friend class PrimeRange;
+    explicit iterator(PrimeRange *range) noexcept : range_(range) {}
+    PrimeRange *range_ = nullptr;
+  };
+
+  PrimeRange(std::uint64_t lo, std::uint64_t hi) : lo_(lo), hi_(hi) {}
+
+  // La primera llamada calcula el primer primo; las siguientes devuelven
+  // la posición actual.
+  iterator begin() {
+    if (!started_) {
+      started_ = true;
+      exhausted_ = !next();
+    }
+    return exhausted_ ? iterator() : iterator(this);
+  }
+  iterator end() noexcept { return iterator(); }
+
+private:
+  bool next() {
+    if (!two_checked_) {
+      two_checked_ = true;
+      if (lo_ <= 2 && hi_ >= 2) {
+        current_ = 2;
+        return true;
+      }
+    }
+    if (!segment_) {
+      // Impares de [max(lo, 3), hi], como índices n = 2i + 1
+      const std::uint64_t first = lo_ < 3 ? 3 : lo_ | 1;
+      const std::uint64_t last = (hi_ & 1) != 0 ? hi_ : hi_ - 1;
+      if (hi_ < 3 || first > last) {
+        exhausted_ = true;
+        return false;
+      }
+      last_index_ = (last - 1) / 2;
+      segment_.emplace(internal::sieve_base_primes(hi_), (first - 1) / 2);
+      bits_ = segment_->words()[0];
+    }
+    for (;;) {
+      while (bits_ == 0) {
+        if (++word_ == internal::SIEVE_SEGMENT_WORDS) {
+          if (segment_->first_index() + internal::SIEVE_SEGMENT_BITS >
+              last_index_) {
+            exhausted_ = true;
+            return false;
+          }
+          segment_->advance();
+          word_ = 0;
+        }
+        bits_ = segment_->words()[word_];
+      }
+      const std::uint64_t index =
+          segment_->first_index() + word_ * 64 + internal::trailing_zeros(bits_);
+      bits_ &= bits_ - 1;
+      if (index > last_index_) {
+        exhausted_ = true;
+        return false;
+      }
+      current_ = 2 * index + 1;
+      return true;
+    }
+  }
+
+  std::uint64_t lo_;
+  std::uint64_t hi_;
+  std::optional<internal::SieveSegment> segment_;
+  std::uint64_t last_index_ = 0;
+  std::size_t word_ = 0;
+  std::uint64_t bits_ = 0;
+  std::uint64_t current_ = 0;
+  bool started_ = false;
+  bool exhausted_ = false;
+  bool two_checked_ = false;
+};
+
+/**
+ * @brief Los primos de [lo, hi], en orden creciente y bajo demanda.
+ *
+ * @return Un `core::Expected<PrimeRange>`:
+ * - .value() con el rango (vacío si lo > hi).
+ * - .error() (MathError::Overflow) si hi > SEGMENTED_SIEVE_MAX_LIMIT.
+ *
+ * @test_property primes_in(10, 30) == {11, 13, 17, 19, 23, 29}
+ *
+ * @optimize_note La memoria es O(sqrt(hi)) sea cual sea hi - lo: se puede
+ *                recorrer un tramo de 10^12 sin materializarlo.
+ */
+inline core::Expected<PrimeRange> primes_in(std::uint64_t lo,
+                                            std::uint64_t hi) noexcept {
+  if (hi > SEGMENTED_SIEVE_MAX_LIMIT) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+  return PrimeRange(lo, hi);
+}
+
+/**
+ * @brief pi(n): número de primos <= n.
+ *
+ * @param config Hilos y umbral de paralelismo (en impares cribados; cada
+ *               bloque tiene al menos un segmento).
+ * @return Un `core::Expected<std::uint64_t>`:
+ * - .value() con pi(n).
+ * - .error() (MathError::Overflow) si n > SEGMENTED_SIEVE_MAX_LIMIT.
+ *
+ * @test_property prime_count(100) == 25
+ * @test_property prime_count(10^9) == 50847534
+ *
+ * @optimize_note Frente a la criba clásica sobre un array de n / 2 bits,
+ *                ~6x más rápida en un solo hilo para n entre 10^7 y 10^9
+ *                (ver benchmarks/bench_prime_sieve.cpp), con memoria
+ *                O(sqrt(n)).
+ */
+inline core::Expected<std::uint64_t>
+prime_count(std::uint64_t n, const ParallelConfig &config = {}) noexcept {
+  if (n > SEGMENTED_SIEVE_MAX_LIMIT) {
+    return core::Unexpected(core::MathError::Overflow);
+  }
+  if (n < 3) {
+    return std::uint64_t{n == 2 ? 1u : 0u};
+  }
+  // Índices de impares 1..last (el 3 es el índice 1; el 1 no es primo)
+  const std::uint64_t last_index = ((n & 1) != 0 ? n - 1 : n - 2) / 2;
+  const std::uint64_t count = last_index;
+  const std::uint64_t segments =
+      (count + internal::SIEVE_SEGMENT_BITS - 1) / internal::SIEVE_SEGMENT_BITS;
+  std::size_t chunks = internal::parallel_chunk_count(
+      static_cast<std::size_t>(count), config);
+  if (chunks > segments) {
+    chunks = static_cast<std::size_t>(segments);
+  }
+
+  const auto base_primes = internal::sieve_base_primes(n);
+  std::vector<std::uint64_t> partials(chunks, 0);
+  internal::parallel_for_chunks(chunks, config.thread_count, [&](std::size_t c) {
+    const std::uint64_t first = 1 + count * c / chunks;
+    const std::uint64_t end = 1 + count * (c + 1) / chunks; // exclusivo
+    internal::SieveSegment segment(base_primes, first);
+    std::uint64_t total = 0;
+    for (;;) {
+      const std::uint64_t segment_end =
+          segment.first_index() + internal::SIEVE_SEGMENT_BITS;
+      if (segment_end >= end) {
+        total += segment.count(0, end - segment.first_index());
+        break;
+      }
+      total += segment.count(0, internal::SIEVE_SEGMENT_BITS);
+      segment.advance();
+    }
+    partials[c] = total;
+  });
+
+  std::uint64_t primes = 1; // El 2
+  for (const std::uint64_t partial : partials) {
+    primes += partial;
+  }
+  return primes;
+}
+
+} // namespace numbers_calculations::math
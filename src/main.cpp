@@ -216,7 +216,7 @@ int main() {
   test_permutations(10LL, 3LL);
   test_combinations(10LL, 3LL);
   test_combinations(20LL, 10LL);       // C(20,10)
-  test_combinations(68_i128, 34_i128); // Overflow
+  test_combinations(131_i128, 65_i128); // Overflow
 
   std::cout << "\n--- [Demo Finalizada] ---\n";
 
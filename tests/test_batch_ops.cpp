@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/math_errors.hpp>
+#include <numbers_calculations/math/batch_ops.hpp>
+
+using namespace numbers_calculations;
+using core::MathError;
+namespace mp = boost::multiprecision;
+
+TEST_CASE("Batch operations", "[batch]") {
+
+  SECTION("factorial_batch matches factorial (native, branch-free path)") {
+    std::vector<std::int32_t> n;
+    for (std::int32_t i = -3; i < 30; ++i) {
+      n.push_back(i);
+    }
+    std::vector<std::int32_t> out(n.size());
+    std::vector<MathError> status(n.size());
+
+    std::size_t expected_errors = 0;
+    const auto errors =
+        math::factorial_batch(n.data(), n.size(), out.data(), status.data());
+    for (std::size_t i = 0; i < n.size(); ++i) {
+      const auto scalar = math::factorial(n[i]);
+      if (scalar) {
+        CHECK(status[i] == MathError::NoError);
+        CHECK(out[i] == *scalar);
+      } else {
+        CHECK(status[i] == scalar.error());
+        CHECK(out[i] == 0);
+        ++expected_errors;
+      }
+    }
+    CHECK(errors == expected_errors);
+    CHECK(status[0] == MathError::DomainError); // -3!
+    CHECK(status[3 + 13] == MathError::Overflow); // 13! no cabe en int32
+  }
+
+  SECTION("factorial_batch with uint64 and Boost types") {
+    const std::vector<std::uint64_t> n = {0, 1, 5, 20, 21};
+    std::vector<std::uint64_t> out(n.size());
+    std::vector<MathError> status(n.size());
+    CHECK(math::factorial_batch(n.data(), n.size(), out.data(),
+                                status.data()) == 1);
+    CHECK(out[3] == 2432902008176640000ULL);
+    CHECK(status[4] == MathError::Overflow);
+
+    const std::vector<mp::cpp_int> big = {0, 30, 50};
+    std::vector<mp::cpp_int> big_out(big.size());
+    std::vector<MathError> big_status(big.size());
+    CHECK(math::factorial_batch(big.data(), big.size(), big_out.data(),
+                                big_status.data()) == 0);
+    CHECK(big_out[2] == *math::factorial(mp::cpp_int(50)));
+  }
+
+  SECTION("combinations_batch matches combinations") {
+    std::vector<std::int64_t> n;
+    std::vector<std::int64_t> k;
+    for (std::int64_t i = -1; i < 75; ++i) {
+      for (std::int64_t j = -1; j <= i + 1; ++j) {
+        n.push_back(i);
+        k.push_back(j);
+      }
+    }
+    std::vector<std::int64_t> out(n.size());
+    std::vector<MathError> status(n.size());
+
+    std::size_t expected_errors = 0;
+    const auto errors = math::combinations_batch(n.data(), k.data(), n.size(),
+                                                 out.data(), status.data());
+    for (std::size_t i = 0; i < n.size(); ++i) {
+      const auto scalar = math::combinations(n[i], k[i]);
+      if (scalar) {
+        REQUIRE(status[i] == MathError::NoError);
+        REQUIRE(out[i] == *scalar);
+      } else {
+        REQUIRE(status[i] == scalar.error());
+        ++expected_errors;
+      }
+    }
+    CHECK(errors == expected_errors);
+  }
+
+  SECTION("combinations_batch with uint128") {
+    const std::vector<core::uint128_t> n = {10, 131, 132, 200};
+    const std::vector<core::uint128_t> k = {3, 65, 66, 2};
+    std::vector<core::uint128_t> out(n.size());
+    std::vector<MathError> status(n.size());
+    CHECK(math::combinations_batch(n.data(), k.data(), n.size(), out.data(),
+                                   status.data()) == 1);
+    CHECK(out[0] == 120);
+    CHECK(status[2] == MathError::Overflow);
+    CHECK(out[3] == 19900);
+  }
+
+  SECTION("integer_power_batch matches integer_power") {
+    const std::vector<std::uint32_t> base = {2, 2, 3, 10, 10, 7, 0};
+    const std::vector<unsigned> exp = {10, 32, 20, 9, 10, 11, 0};
+    std::vector<std::uint32_t> out(base.size());
+    std::vector<MathError> status(base.size());
+    CHECK(math::integer_power_batch(base.data(), exp.data(), base.size(),
+                                    out.data(), status.data()) == 2);
+    CHECK(out[0] == 1024);
+    CHECK(status[1] == MathError::Overflow); // 2^32 no cabe en uint32
+    CHECK(out[2] == 3486784401u);
+    CHECK(out[3] == 1000000000u);
+    CHECK(status[4] == MathError::Overflow);
+    CHECK(out[5] == 1977326743u);
+    CHECK(out[6] == 1);
+  }
+
+  SECTION("integer_log2_batch matches integer_log2") {
+    std::vector<std::uint64_t> n = {0, 1, 2, 3, 1023, 1024,
+                                    ~std::uint64_t{0}};
+    std::vector<unsigned> out(n.size());
+    std::vector<MathError> status(n.size());
+    CHECK(math::integer_log2_batch(n.data(), n.size(), out.data(),
+                                   status.data()) == 1);
+    CHECK(status[0] == MathError::DomainError);
+    CHECK(out[1] == 0);
+    CHECK(out[3] == 1);
+    CHECK(out[4] == 9);
+    CHECK(out[5] == 10);
+    CHECK(out[6] == 63);
+
+    const std::vector<core::uint128_t> wide = {core::uint128_t{1} << 100, 0};
+    std::vector<unsigned> wide_out(wide.size());
+    std::vector<MathError> wide_status(wide.size());
+    CHECK(math::integer_log2_batch(wide.data(), wide.size(), wide_out.data(),
+                                   wide_status.data()) == 1);
+    CHECK(wide_out[0] == 100);
+    CHECK(wide_status[1] == MathError::DomainError);
+  }
+
+#if HAS_CPP20_SPAN
+  SECTION("std::span overloads") {
+    const std::vector<std::uint64_t> n = {4, 5, 6};
+    std::vector<std::uint64_t> out(n.size());
+    std::vector<MathError> status(n.size());
+    CHECK(math::factorial_batch<std::uint64_t>(n, out, status) == 0);
+    CHECK(out[2] == 720);
+  }
+#endif
+}
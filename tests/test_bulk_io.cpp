@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/io/bulk_io.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+using core::int128_t;
+using core::uint128_t;
+using io::IoError;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+// Muchos bloques pequeños aunque la máquina tenga un solo núcleo.
+math::ParallelConfig many_chunks() {
+  math::ParallelConfig config;
+  config.thread_count = 4;
+  config.serial_cutoff = 16;
+  config.chunks_per_thread = 8;
+  return config;
+}
+
+std::string temp_path(const char *name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+} // namespace
+
+TEST_CASE("Bulk integer I/O", "[bulk_io]") {
+
+  SECTION("parse_integers reports errors per line") {
+    const std::string text = "1\n"
+                             "x\n"
+                             "-3\r\n"
+                             "  +4 \n"
+                             "\n"
+                             "340282366920938463463374607431768211456\n"
+                             "12ab\n"
+                             "340282366920938463463374607431768211455";
+    for (const auto &config : {math::ParallelConfig{}, many_chunks()}) {
+      const auto u = io::parse_integers<uint128_t>(text, config);
+      REQUIRE(u.values.size() == 8);
+      CHECK(u.values[0] == 1);
+      CHECK(u.values[1] == 0);
+      CHECK(u.values[3] == 4);
+      CHECK(u.values[7] == std::numeric_limits<uint128_t>::max());
+      REQUIRE(u.errors.size() == 5);
+      CHECK(u.errors[0].line == 2);
+      CHECK(u.errors[0].error == IoError::InvalidFormat);
+      CHECK(u.errors[1].line == 3); // '-' en un tipo sin signo
+      CHECK(u.errors[2].line == 5); // línea vacía
+      CHECK(u.errors[3].line == 6);
+      CHECK(u.errors[3].error == IoError::Overflow);
+      CHECK(u.errors[4].line == 7);
+
+      const auto s = io::parse_integers<std::int64_t>(text, config);
+      CHECK(s.values[2] == -3);
+      CHECK(s.errors.size() == 5); // 2, 5, 6, 7 y 8 (overflow)
+      CHECK(s.errors.back().error == IoError::Overflow);
+    }
+    CHECK(io::parse_integers<int>("").values.empty());
+    CHECK(io::parse_integers<int>("7\n").values.size() == 1);
+  }
+
+  SECTION("Chunking does not depend on the thread split") {
+    std::mt19937_64 rng(24);
+    std::string text;
+    std::vector<int128_t> expected;
+    for (int i = 0; i < 5000; ++i) {
+      const auto v = static_cast<int128_t>(
+          ((uint128_t{rng()} << 64) | rng()) >> (rng() % 128));
+      expected.push_back(v);
+      char buffer[41];
+      text.append(buffer, core::to_chars(buffer, buffer + 41, v).ptr);
+      text += '\n';
+    }
+    const auto result = io::parse_integers<int128_t>(text, many_chunks());
+    CHECK(result.errors.empty());
+    CHECK(result.values == expected);
+  }
+
+  SECTION("Boost types") {
+    const std::string text = "007\n"
+                             "-12345678901234567890123456789012345678901\n"
+                             "1e5\n"
+                             "-";
+    const auto big = io::parse_integers<mp::cpp_int>(text, many_chunks());
+    REQUIRE(big.values.size() == 4);
+    CHECK(big.values[0] == 7); // No es octal
+    CHECK(big.values[1] ==
+          mp::cpp_int("-12345678901234567890123456789012345678901"));
+    REQUIRE(big.errors.size() == 2);
+    CHECK(big.errors[0].line == 3);
+    CHECK(big.errors[1].line == 4);
+
+    const auto narrow =
+        io::parse_integers<mp::int128_t>(text, math::ParallelConfig{});
+    CHECK(narrow.values[0] == 7);
+    REQUIRE(narrow.errors.size() == 3);
+    CHECK(narrow.errors[0].line == 2);
+    CHECK(narrow.errors[0].error == IoError::Overflow);
+  }
+
+  SECTION("write_integers and read_integers round trip") {
+    const std::string path = temp_path("numbers_calculations_bulk_io.txt");
+    std::vector<uint128_t> values(200000);
+    std::mt19937_64 rng(2024);
+    for (auto &v : values) {
+      v = ((uint128_t{rng()} << 64) | rng()) >> (rng() % 128);
+    }
+    const auto written = io::write_integers(path, values, many_chunks());
+    REQUIRE(written.has_value());
+    CHECK(*written == std::filesystem::file_size(path));
+
+    const auto read = io::read_integers<uint128_t>(path, many_chunks());
+    REQUIRE(read.has_value());
+    CHECK(read->errors.empty());
+    CHECK(read->values == values);
+
+    std::vector<mp::cpp_int> big{mp::cpp_int(1) << 300, -mp::cpp_int(5), 0};
+    REQUIRE(io::write_integers(path, big).has_value());
+    const auto big_read = io::read_integers<mp::cpp_int>(path);
+    REQUIRE(big_read.has_value());
+    CHECK(big_read->values == big);
+
+    std::vector<std::int32_t> empty;
+    REQUIRE(io::write_integers(path, empty).value() == 0);
+    CHECK(io::read_integers<std::int32_t>(path).value().values.empty());
+    std::remove(path.c_str());
+  }
+
+  SECTION("File errors") {
+    const std::string missing = temp_path("numbers_calculations_missing/x.txt");
+    CHECK(io::read_integers<int>(missing).error() == IoError::OpenFailed);
+    const std::vector<int> values{1, 2, 3};
+    CHECK(io::write_integers(missing, values).error() == IoError::OpenFailed);
+  }
+}
@@ -0,0 +1,104 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <limits>
+
+#include <numbers_calculations/core/checked_arith.hpp>
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/math_errors.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+using core::MathError;
+namespace mp = boost::multiprecision;
+
+TEST_CASE("Checked arithmetic", "[checked_arith]") {
+
+  SECTION("Native unsigned types") {
+    constexpr auto u64_max = std::numeric_limits<std::uint64_t>::max();
+    CHECK(core::checked_mul<std::uint64_t>(3, 4).value() == 12);
+    CHECK(core::checked_mul<std::uint64_t>(1ULL << 32, 1ULL << 31).value() ==
+          1ULL << 63);
+    CHECK(core::checked_mul<std::uint64_t>(1ULL << 32, 1ULL << 32).error() ==
+          MathError::Overflow);
+    CHECK(core::checked_add<std::uint64_t>(u64_max - 1, 1).value() == u64_max);
+    CHECK(core::checked_add<std::uint64_t>(u64_max, 1).error() ==
+          MathError::Overflow);
+    CHECK(core::checked_mul_add<std::uint64_t>(u64_max / 10, 10, 5).value() ==
+          u64_max);
+    CHECK(core::checked_mul_add<std::uint64_t>(u64_max / 10, 10, 6).error() ==
+          MathError::Overflow);
+    CHECK(core::checked_mul<std::uint8_t>(16, 16).error() ==
+          MathError::Overflow);
+    CHECK(core::checked_mul<std::uint8_t>(15, 17).value() == 255);
+
+    constexpr auto u128_max = std::numeric_limits<core::uint128_t>::max();
+    CHECK(core::checked_mul(u128_max, 2_ui128).error() == MathError::Overflow);
+    CHECK(core::checked_mul(1_ui128 << 64, (1_ui128 << 63) + 1).value() ==
+          (1_ui128 << 127) + (1_ui128 << 64));
+    CHECK(core::checked_add(u128_max, 1_ui128).error() == MathError::Overflow);
+
+    static_assert(*core::checked_mul<std::uint32_t>(65535, 65537) ==
+                  4294967295u);
+    static_assert(!core::checked_mul<std::uint32_t>(65536, 65536));
+  }
+
+  SECTION("Native signed types") {
+    constexpr auto i32_min = std::numeric_limits<std::int32_t>::min();
+    constexpr auto i32_max = std::numeric_limits<std::int32_t>::max();
+    CHECK(core::checked_mul<std::int32_t>(-46341, 46340).value() ==
+          -2147441940);
+    CHECK(core::checked_mul<std::int32_t>(-46341, 46341).error() ==
+          MathError::Overflow);
+    CHECK(core::checked_mul<std::int32_t>(i32_min, 1).value() == i32_min);
+    CHECK(core::checked_mul<std::int32_t>(i32_min, -1).error() ==
+          MathError::Overflow);
+    CHECK(core::checked_add<std::int32_t>(i32_max, -1).value() ==
+          i32_max - 1);
+    CHECK(core::checked_add<std::int32_t>(i32_min, -1).error() ==
+          MathError::Overflow);
+    CHECK(core::checked_mul(-1_i128 << 126, 2_i128).value() == -1_i128 << 127);
+    CHECK(core::checked_mul(1_i128 << 126, 2_i128).error() ==
+          MathError::Overflow);
+  }
+
+  SECTION("Output aliasing an operand") {
+    std::uint32_t x = 2401;
+    CHECK_FALSE(core::mul_overflow(x, x, x));
+    CHECK(x == 5764801u);
+    CHECK(core::mul_overflow(x, x, x));
+
+    core::uint128_t y = 1_ui128 << 100;
+    CHECK_FALSE(core::add_overflow(y, y, y));
+    CHECK(y == 1_ui128 << 101);
+  }
+
+  SECTION("Boost types") {
+    const mp::uint256_t half = mp::uint256_t(1) << 128;
+    CHECK(core::checked_mul(half, mp::uint256_t(half - 1)).value() ==
+          (half - 1) * half);
+    CHECK(core::checked_mul(half, half).error() == MathError::Overflow);
+    // Frontera exacta: bits(a) + bits(b) == 257
+    const mp::uint256_t a = (mp::uint256_t(1) << 128) + 1;
+    const mp::uint256_t b = (mp::uint256_t(1) << 128) - 1;
+    CHECK(core::checked_mul(a, b).value() == (mp::uint256_t(0) - 1));
+    CHECK(core::checked_mul(a, a).error() == MathError::Overflow);
+    CHECK(core::checked_add(mp::uint256_t(0) - 1, mp::uint256_t(1)).error() ==
+          MathError::Overflow);
+
+    const mp::int256_t neg = -(mp::int256_t(1) << 200);
+    CHECK(core::checked_mul(neg, mp::int256_t(1) << 55).value() ==
+          -(mp::int256_t(1) << 255));
+    CHECK(core::checked_mul(neg, -(mp::int256_t(1) << 56)).error() ==
+          MathError::Overflow);
+    CHECK(core::checked_add(std::numeric_limits<mp::int256_t>::min(),
+                            mp::int256_t(-1))
+              .error() == MathError::Overflow);
+
+    const mp::cpp_int big = mp::cpp_int(1) << 5000;
+    CHECK(core::checked_mul(big, big).value() == mp::cpp_int(1) << 10000);
+    CHECK(core::checked_mul_add(big, mp::cpp_int(3), mp::cpp_int(-1))
+              .value() == 3 * big - 1);
+  }
+}
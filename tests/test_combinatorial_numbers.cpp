@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/math_errors.hpp>
+#include <numbers_calculations/math/combinatorial_numbers.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+using core::MathError;
+namespace mp = boost::multiprecision;
+
+TEST_CASE("Combinatorial numbers", "[combinatorial_numbers]") {
+
+  SECTION("Multinomial coefficients") {
+    CHECK(math::multinomial({2, 3, 4}).value() == 1260);
+    CHECK(math::multinomial<std::uint64_t>({}).value() == 1);
+    CHECK(math::multinomial({10ULL, 10ULL, 10ULL}).value() == 5550996791340ULL);
+    CHECK(math::multinomial({7, -1}).error() == MathError::DomainError);
+    // multinomial({n, k}) == C(n + k, k)
+    for (std::uint64_t n = 0; n < 34; ++n) {
+      for (std::uint64_t k = 0; k < 34; ++k) {
+        REQUIRE(math::multinomial({n, k}).value() ==
+                math::combinations(n + k, k).value());
+      }
+    }
+    CHECK(math::multinomial({40ULL, 40ULL}).error() == MathError::Overflow);
+
+    // Camino de Boost (exponentes primos)
+    const auto big = math::multinomial<mp::cpp_int>({100, 120, 80});
+    CHECK(big.value() == *math::factorial(mp::cpp_int(300)) /
+                             (*math::factorial(mp::cpp_int(100)) *
+                              *math::factorial(mp::cpp_int(120)) *
+                              *math::factorial(mp::cpp_int(80))));
+  }
+
+  SECTION("Catalan numbers") {
+    CHECK(math::catalan(0).value() == 1);
+    CHECK(math::catalan(10).value() == 16796);
+    CHECK(math::catalan(-1).error() == MathError::DomainError);
+    CHECK(math::catalan(std::uint64_t{36}).has_value());
+    CHECK(math::catalan(std::uint64_t{37}).error() == MathError::Overflow);
+    CHECK(math::catalan(69_ui128).value() ==
+          337485502510215975556783793455058624700_ui128);
+    CHECK(math::catalan(70_ui128).error() == MathError::Overflow);
+
+    // La LUT y el camino de Boost (Kummer) coinciden con C(2n, n) / (n+1)
+    for (int n = 0; n < 120; ++n) {
+      const mp::cpp_int m = n;
+      REQUIRE(math::catalan(m).value() ==
+              *math::combinations(mp::cpp_int(2 * m), m) / (m + 1));
+    }
+    CHECK(math::catalan(mp::uint256_t(100)).value() ==
+          mp::uint256_t("896519947090131496687170070074100632420837521538745909"
+                        "320"));
+    CHECK(math::catalan(mp::uint128_t(70)).error() == MathError::Overflow);
+  }
+
+  SECTION("Bell numbers") {
+    CHECK(math::bell(0).value() == 1);
+    CHECK(math::bell(10).value() == 115975);
+    CHECK(math::bell(-3).error() == MathError::DomainError);
+    CHECK(math::bell(std::uint64_t{25}).has_value());
+    CHECK(math::bell(std::uint64_t{26}).error() == MathError::Overflow);
+    CHECK(math::bell(42_ui128).value() ==
+          35742549198872617291353508656626642567_ui128);
+    CHECK(math::bell(43_ui128).error() == MathError::Overflow);
+
+    // B(n) = sum_k S(n, k), también fuera de la LUT (triángulo de Bell)
+    for (int n = 0; n < 60; ++n) {
+      mp::cpp_int sum = 0;
+      for (int k = 0; k <= n; ++k) {
+        sum += *math::stirling_second(mp::cpp_int(n), mp::cpp_int(k));
+      }
+      REQUIRE(math::bell(mp::cpp_int(n)).value() == sum);
+    }
+    CHECK(math::bell(mp::cpp_int(150)).value() % 1000000007 == 549999484);
+  }
+
+  SECTION("Stirling numbers") {
+    CHECK(math::stirling_first(5, 2).value() == 50);
+    CHECK(math::stirling_second(5, 2).value() == 15);
+    CHECK(math::stirling_second(3, 5).value() == 0);
+    CHECK(math::stirling_first(-1, 0).error() == MathError::DomainError);
+
+    // Fuera de la LUT: formas cerradas y banda sin overflow espurio
+    CHECK(math::stirling_second(std::uint64_t{100}, std::uint64_t{98}).value() ==
+          11925375);
+    CHECK(math::stirling_first(std::uint64_t{60}, std::uint64_t{57}).value() ==
+          863113950);
+    CHECK(math::stirling_second(std::uint64_t{64}, std::uint64_t{2}).value() ==
+          9223372036854775807ULL); // 2^63 - 1
+    CHECK(math::stirling_second(std::uint64_t{66}, std::uint64_t{2}).error() ==
+          MathError::Overflow);
+    CHECK(math::stirling_first(std::uint64_t{1000}, std::uint64_t{999})
+              .value() == 499500);
+    CHECK(math::stirling_first(std::uint64_t{40}, std::uint64_t{1}).error() ==
+          MathError::Overflow);
+    CHECK(math::stirling_second(150_ui128, 140_ui128).value() ==
+          3669574403496312549395294868828825_ui128);
+    CHECK(math::stirling_first(40_ui128, 30_ui128).value() ==
+          4344363139637533397580_ui128);
+
+    CHECK(math::stirling_second(mp::cpp_int(200), mp::cpp_int(100)).value() %
+              1000000007 ==
+          259984850);
+    CHECK(math::stirling_first(mp::cpp_int(120), mp::cpp_int(60)).value() %
+              1000000007 ==
+          507282178);
+  }
+
+  SECTION("Incremental row generators") {
+    math::StirlingRows<std::uint64_t, math::StirlingKind::Second> second;
+    for (int i = 0; i < 4; ++i) {
+      REQUIRE(second.next().has_value());
+    }
+    CHECK(second.row() == std::vector<std::uint64_t>{0, 1, 7, 6, 1});
+
+    // Las filas generadas coinciden con las LUTs
+    math::StirlingRows<core::uint128_t, math::StirlingKind::First> first;
+    math::StirlingRows<core::uint128_t, math::StirlingKind::Second> second128;
+    for (int n = 1; n < 35; ++n) {
+      REQUIRE(first.next().has_value());
+      REQUIRE(second128.next().has_value());
+      for (int k = 0; k <= n; ++k) {
+        REQUIRE(first.row()[k] ==
+                *math::stirling_first(core::uint128_t(n), core::uint128_t(k)));
+        REQUIRE(second128.row()[k] == *math::stirling_second(
+                                          core::uint128_t(n), core::uint128_t(k)));
+      }
+    }
+    // La fila 35 de la primera especie ya no cabe: la fila actual no cambia
+    CHECK(first.next().error() == MathError::Overflow);
+    CHECK(first.index() == 34);
+
+    math::BellTriangleRows<std::uint64_t> triangle;
+    for (int i = 0; i < 3; ++i) {
+      REQUIRE(triangle.next().has_value());
+    }
+    CHECK(triangle.row() == std::vector<std::uint64_t>{5, 7, 10, 15});
+    CHECK(triangle.bell() == 5);
+    while (triangle.next()) {
+    }
+    CHECK(triangle.bell() == *math::bell(std::uint64_t(triangle.index())));
+  }
+}
@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <numbers_calculations/core/math_errors.hpp>
+#include <numbers_calculations/math/combinatorial_views.hpp>
+
+using namespace numbers_calculations;
+using core::MathError;
+using Indices = std::vector<std::size_t>;
+
+TEST_CASE("Combinatorial views", "[combinatorial_views]") {
+
+  SECTION("combinations_view enumerates k-subsets in colex order") {
+    std::vector<Indices> seen;
+    for (const auto &c : math::combinations_view(4, 2)) {
+      seen.push_back(c);
+    }
+    CHECK(seen == std::vector<Indices>{
+                      {0, 1}, {0, 2}, {1, 2}, {0, 3}, {1, 3}, {2, 3}});
+
+    CHECK(math::combinations_view(5, 0).size() == 1);
+    CHECK(math::combinations_view(3, 4).empty());
+
+    // Todas distintas, crecientes y en número C(n, k)
+    std::set<Indices> unique;
+    for (const auto &c : math::combinations_view(12, 5)) {
+      REQUIRE(std::is_sorted(c.begin(), c.end()));
+      unique.insert(c);
+    }
+    CHECK(unique.size() == 792);
+  }
+
+  SECTION("combination_masks_view matches combinations_view (Gosper)") {
+    std::vector<std::uint64_t> masks;
+    for (const auto m : math::combination_masks_view(4, 2)) {
+      masks.push_back(m);
+    }
+    CHECK(masks ==
+          std::vector<std::uint64_t>{0b0011, 0b0101, 0b0110, 0b1001, 0b1010,
+                                     0b1100});
+
+    const auto view = math::combinations_view(16, 6);
+    auto it = view.begin();
+    for (const auto m : math::combination_masks_view(16, 6)) {
+      std::uint64_t expected = 0;
+      for (const auto i : *it) {
+        expected |= std::uint64_t{1} << i;
+      }
+      REQUIRE(m == expected);
+      REQUIRE(math::combination_mask_rank(m).value() == it.rank());
+      ++it;
+    }
+    CHECK(it == view.end());
+
+    // n = 64: la última máscara tiene el bit 63 activo
+    const auto tail = math::combination_masks_view(64, 2, 2014, 2016);
+    std::vector<std::uint64_t> last_masks(tail.begin(), tail.end());
+    CHECK(last_masks.back() == (std::uint64_t{3} << 62));
+    CHECK(math::combination_masks_view(65, 2).empty());
+  }
+
+  SECTION("Combination rank / unrank") {
+    const Indices first = {0, 1, 2};
+    CHECK(math::combination_rank(first.begin(), first.end()).value() == 0);
+    const Indices unsorted = {2, 1};
+    CHECK(math::combination_rank(unsorted.begin(), unsorted.end()).error() ==
+          MathError::DomainError);
+
+    for (const auto &c : math::combinations_view(10, 4)) {
+      const auto r = math::combination_rank(c.begin(), c.end()).value();
+      REQUIRE(math::combination_unrank(r, 10, 4).value() == c);
+    }
+    CHECK(math::combination_unrank(210, 10, 4).error() ==
+          MathError::DomainError);
+
+    // n grande: C(100000, 3) cabe en 64 bits
+    const auto c = math::combination_unrank(123456789012ULL, 100000, 3).value();
+    CHECK(math::combination_rank(c.begin(), c.end()).value() ==
+          123456789012ULL);
+  }
+
+  SECTION("permutations_view and permutation rank / unrank") {
+    std::vector<Indices> seen;
+    for (const auto &p : math::permutations_view(3)) {
+      seen.push_back(p);
+    }
+    CHECK(seen == std::vector<Indices>{{0, 1, 2},
+                                       {0, 2, 1},
+                                       {1, 0, 2},
+                                       {1, 2, 0},
+                                       {2, 0, 1},
+                                       {2, 1, 0}});
+
+    std::uint64_t expected_rank = 0;
+    const auto view = math::permutations_view(6);
+    for (auto it = view.begin(); it != view.end(); ++it, ++expected_rank) {
+      REQUIRE(it.rank() == expected_rank);
+      REQUIRE(math::permutation_rank(it->begin(), it->end()).value() ==
+              expected_rank);
+      REQUIRE(math::permutation_unrank(expected_rank, 6).value() == *it);
+    }
+    CHECK(expected_rank == 720);
+
+    const Indices bad = {0, 0, 1};
+    CHECK(math::permutation_rank(bad.begin(), bad.end()).error() ==
+          MathError::DomainError);
+    CHECK(math::permutation_unrank(6, 3).error() == MathError::DomainError);
+
+    // n > 20: n! no cabe, pero los rangos pequeños sí
+    const auto p = math::permutation_unrank(5, 25).value();
+    CHECK(math::permutation_rank(p.begin(), p.end()).value() == 5);
+  }
+
+  SECTION("Rank ranges split the work across threads") {
+    const std::size_t n = 20;
+    const std::size_t k = 7;
+    const std::uint64_t total = math::combinations_view(n, k).size();
+    const unsigned parts = 4;
+
+    std::vector<std::vector<Indices>> chunks(parts);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < parts; ++t) {
+      workers.emplace_back([&, t] {
+        for (const auto &c : math::combinations_view(
+                 n, k, total * t / parts, total * (t + 1) / parts)) {
+          chunks[t].push_back(c);
+        }
+      });
+    }
+    for (auto &w : workers) {
+      w.join();
+    }
+
+    std::vector<Indices> joined;
+    for (const auto &chunk : chunks) {
+      joined.insert(joined.end(), chunk.begin(), chunk.end());
+    }
+    std::vector<Indices> serial;
+    for (const auto &c : math::combinations_view(n, k)) {
+      serial.push_back(c);
+    }
+    CHECK(joined == serial);
+  }
+}
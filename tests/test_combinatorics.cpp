@@ -12,9 +12,13 @@
 #include <numbers_calculations/core/constexpr_literals.hpp>
 #include <numbers_calculations/core/math_errors.hpp>
 #include <numbers_calculations/math/combinatorics.hpp>
+#include <numbers_calculations/math/parallel_product.hpp>
+#include <cstdint>
+#include <vector>
 
 using namespace numbers_calculations;
 using namespace numbers_calculations::core::literals;
+namespace mp = boost::multiprecision;
 
 TEST_CASE("Factorial function", "[combinatorics][factorial]") {
 
@@ -76,6 +80,106 @@ TEST_CASE("Factorial function", "[combinatorics][factorial]") {
     REQUIRE(r40_mp.has_value());
   }
 
+  SECTION("Factorial with product tree (Boost types)") {
+    using mp::cpp_int;
+    // Comparamos contra el producto lineal de referencia
+    cpp_int expected170 = 1;
+    for (unsigned i = 2; i <= 170; ++i) {
+      expected170 *= i;
+    }
+    cpp_int expected1000 = expected170;
+    for (unsigned i = 171; i <= 1000; ++i) {
+      expected1000 *= i;
+    }
+    auto r1000 = math::factorial(cpp_int(1000));
+    REQUIRE(r1000.has_value());
+    REQUIRE(r1000.value() == expected1000);
+
+    // 170! cabe en 1024 bits, 171! no
+    auto r170 = math::factorial(mp::uint1024_t(170));
+    REQUIRE(r170.has_value());
+    REQUIRE(cpp_int(r170.value()) == expected170);
+
+    auto r171 = math::factorial(mp::uint1024_t(171));
+    REQUIRE_FALSE(r171.has_value());
+    REQUIRE(r171.error() == core::MathError::Overflow);
+  }
+
+  SECTION("Factorial with prime-swing (arbitrary precision)") {
+    using mp::cpp_int;
+    cpp_int expected = 1;
+    for (unsigned i = 2; i <= 5000; ++i) {
+      expected *= i;
+    }
+    auto r5000 = math::factorial(cpp_int(5000));
+    REQUIRE(r5000.has_value());
+    REQUIRE(r5000.value() == expected);
+  }
+
+  SECTION("Factorial in parallel mode") {
+    math::ParallelConfig config;
+    config.thread_count = 4;
+    config.serial_cutoff = 64;
+    auto r_par = math::factorial(mp::cpp_int(3000), config);
+    REQUIRE(r_par.has_value());
+    REQUIRE(r_par.value() == math::factorial(mp::cpp_int(3000)).value());
+
+    // Tipos acotados: el overflow se propaga desde los bloques
+    auto r_ovf = math::factorial(mp::uint1024_t(500), config);
+    REQUIRE_FALSE(r_ovf.has_value());
+    REQUIRE(r_ovf.error() == core::MathError::Overflow);
+
+    // Tipos nativos: delega en la versión secuencial
+    auto r20 = math::factorial(20LL, config);
+    REQUIRE(r20.has_value());
+    REQUIRE(r20.value() == 2432902008176640000LL);
+  }
+
+  SECTION("Parallel product over a range of values") {
+    std::vector<mp::cpp_int> values;
+    mp::cpp_int expected = 1;
+    for (unsigned i = 1; i <= 500; ++i) {
+      values.emplace_back(mp::cpp_int(i) * i + 1);
+      expected *= values.back();
+    }
+    math::ParallelConfig config;
+    config.thread_count = 3;
+    config.serial_cutoff = 16;
+    auto r = math::parallel_product(values.begin(), values.end(), config);
+    REQUIRE(r.has_value());
+    REQUIRE(r.value() == expected);
+
+    auto r_empty = math::parallel_product(values.begin(), values.begin());
+    REQUIRE(r_empty.has_value());
+    REQUIRE(r_empty.value() == 1);
+  }
+
+  SECTION("Factorial as prime-exponent vector (Legendre)") {
+    auto f10 = math::factorial_prime_exponents(10);
+    REQUIRE(f10.has_value());
+    REQUIRE(f10->size() == 4);
+    REQUIRE(((*f10)[0].prime == 2 && (*f10)[0].exponent == 8));
+    REQUIRE(((*f10)[1].prime == 3 && (*f10)[1].exponent == 4));
+    REQUIRE(((*f10)[2].prime == 5 && (*f10)[2].exponent == 2));
+    REQUIRE(((*f10)[3].prime == 7 && (*f10)[3].exponent == 1));
+
+    auto f0 = math::factorial_prime_exponents(0);
+    REQUIRE(f0.has_value());
+    REQUIRE(f0->empty());
+
+    auto f700 = math::factorial_prime_exponents(700);
+    REQUIRE(f700.has_value());
+    auto v700 = math::evaluate_prime_exponents<mp::cpp_int>(*f700);
+    REQUIRE(v700.has_value());
+    REQUIRE(v700.value() == math::factorial(mp::cpp_int(700)).value());
+
+    // 170! cabe en 1024 bits, 171! no
+    auto f171 = math::factorial_prime_exponents(171);
+    auto v171 = math::evaluate_prime_exponents<mp::uint1024_t>(*f171);
+    REQUIRE_FALSE(v171.has_value());
+    REQUIRE(v171.error() == core::MathError::Overflow);
+  }
+
   SECTION("Factorial with domain errors") {
     auto r_neg_1 = math::factorial(-1);
     REQUIRE_FALSE(r_neg_1.has_value());
@@ -121,6 +225,20 @@ TEST_CASE("Permutations function", "[combinatorics][permutations]") {
     REQUIRE(r_neg_k.error() == core::MathError::DomainError);
   }
 
+  SECTION("Permutations from the LUTs agree with the loop") {
+    for (unsigned n = 0; n < 40; ++n) {
+      mp::cpp_int expected = 1;
+      for (unsigned k = 0; k <= n; ++k) {
+        auto r64 = math::permutations(std::uint64_t{n}, std::uint64_t{k});
+        auto rmp = math::permutations(mp::cpp_int(n), mp::cpp_int(k));
+        REQUIRE(rmp.has_value());
+        REQUIRE(rmp.value() == expected);
+        REQUIRE(r64.has_value() == (expected <= mp::cpp_int(~std::uint64_t{0})));
+        expected *= n - k;
+      }
+    }
+  }
+
   SECTION("Permutations with overflow") {
     // P(34, 2) cabe en 128 bits, pero P(34, 33) no.
     auto r_overflow = math::permutations(34_i128, 33_i128);
@@ -147,12 +265,224 @@ TEST_CASE("Combinations function", "[combinatorics][combinations]") {
   }
 
   SECTION("Combinations with overflow") {
-    // C(67, 34) es el número central más grande que cabe en 128 bits
-    auto r_ok = math::combinations(67_i128, 34_i128);
+    // C(130, 65) es el número central más grande que cabe en int128_t
+    auto r_ok = math::combinations(130_i128, 65_i128);
     REQUIRE(r_ok.has_value());
 
-    auto r_overflow = math::combinations(68_i128, 34_i128);
+    auto r_overflow = math::combinations(131_i128, 65_i128);
     REQUIRE_FALSE(r_overflow.has_value());
     REQUIRE(r_overflow.error() == core::MathError::Overflow);
   }
-}
\ No newline at end of file
+
+  SECTION("Combinations without spurious intermediate overflow") {
+    // C(66, 33) cabe en uint64_t aunque C(65, 32) * 66 no
+    auto r_66 = math::combinations(std::uint64_t{66}, std::uint64_t{33});
+    REQUIRE(r_66.has_value());
+    REQUIRE(r_66.value() == 7219428434016265740ULL);
+
+    auto r_67 = math::combinations(std::uint64_t{67}, std::uint64_t{33});
+    REQUIRE(r_67.has_value());
+    REQUIRE(r_67.value() == 14226520737620288370ULL);
+
+    auto r_68 = math::combinations(std::uint64_t{68}, std::uint64_t{34});
+    REQUIRE_FALSE(r_68.has_value());
+    REQUIRE(r_68.error() == core::MathError::Overflow);
+
+    // C(131, 65) cabe en uint128_t (intermedios en 256 bits)
+    auto r_131 = math::combinations(131_ui128, 65_ui128);
+    REQUIRE(r_131.has_value());
+    REQUIRE(r_131.value() == 188694833082770476622296176145946360850_ui128);
+
+    auto r_132 = math::combinations(132_ui128, 66_ui128);
+    REQUIRE_FALSE(r_132.has_value());
+    REQUIRE(r_132.error() == core::MathError::Overflow);
+  }
+
+  SECTION("Combinations from the binomial LUT") {
+    static_assert(math::internal::BINOMIALS_LUT_64(10, 3) == 120);
+    static_assert(math::internal::BINOMIALS_LUT_128(131, 66) ==
+                  188694833082770476622296176145946360850_ui128);
+
+    // Comparamos toda la tabla con el triángulo de Pascal en cpp_int
+    std::vector<mp::cpp_int> row{1};
+    for (unsigned n = 0; n < 140; ++n) {
+      for (unsigned k = 0; k <= n; ++k) {
+        auto r128 = math::combinations(core::uint128_t{n}, core::uint128_t{k});
+        auto r64 = math::combinations(std::uint64_t{n}, std::uint64_t{k});
+        auto rmp = math::combinations(mp::cpp_int(n), mp::cpp_int(k));
+        REQUIRE(rmp.has_value());
+        REQUIRE(rmp.value() == row[k]);
+        REQUIRE(r128.has_value() == (row[k] <= mp::cpp_int(~core::uint128_t{0})));
+        REQUIRE(r64.has_value() == (row[k] <= mp::cpp_int(~std::uint64_t{0})));
+        if (r64.has_value()) {
+          REQUIRE(mp::cpp_int(r64.value()) == row[k]);
+        }
+      }
+      std::vector<mp::cpp_int> next(n + 2, 1);
+      for (unsigned k = 1; k <= n; ++k) {
+        next[k] = row[k - 1] + row[k];
+      }
+      row = std::move(next);
+    }
+
+    // Fuera de la tabla: bucle con intermedios de doble ancho
+    auto r_200_3 = math::combinations(200, 3);
+    REQUIRE(r_200_3.has_value());
+    REQUIRE(r_200_3.value() == 1313400);
+  }
+
+  SECTION("Combinations with Boost types (exact prime exponents)") {
+    using mp::cpp_int;
+    // Referencia: C(n, k) = n! / (k! (n-k)!)
+    const auto f = [](unsigned n) { return math::factorial(cpp_int(n)).value(); };
+
+    auto r_small = math::combinations(cpp_int(100), cpp_int(7));
+    REQUIRE(r_small.has_value());
+    REQUIRE(r_small.value() == f(100) / (f(7) * f(93)));
+
+    auto r_kummer = math::combinations(cpp_int(2000), cpp_int(700));
+    REQUIRE(r_kummer.has_value());
+    REQUIRE(r_kummer.value() == f(2000) / (f(700) * f(1300)));
+
+    // Tipos acotados: C(1000, 500) necesita 995 bits
+    auto r_fixed = math::combinations(mp::uint1024_t(1000), mp::uint1024_t(500));
+    REQUIRE(r_fixed.has_value());
+    REQUIRE(cpp_int(r_fixed.value()) == f(1000) / (f(500) * f(500)));
+
+    auto r_fixed_small = math::combinations(mp::uint256_t(200), mp::uint256_t(20));
+    REQUIRE(r_fixed_small.has_value());
+    REQUIRE(cpp_int(r_fixed_small.value()) == f(200) / (f(20) * f(180)));
+
+    auto r_fixed_ovf = math::combinations(mp::uint1024_t(1040), mp::uint1024_t(520));
+    REQUIRE_FALSE(r_fixed_ovf.has_value());
+    REQUIRE(r_fixed_ovf.error() == core::MathError::Overflow);
+
+    auto k10 = math::binomial_prime_exponents(10, 3); // 120 = 2^3 * 3 * 5
+    REQUIRE(k10.has_value());
+    REQUIRE(k10->size() == 3);
+    REQUIRE(((*k10)[0].prime == 2 && (*k10)[0].exponent == 3));
+    REQUIRE(((*k10)[1].prime == 3 && (*k10)[1].exponent == 1));
+    REQUIRE(((*k10)[2].prime == 5 && (*k10)[2].exponent == 1));
+  }
+}
+
+TEST_CASE("Modular combinatorics", "[combinatorics][modular]") {
+  using mp::cpp_int;
+  const auto f = [](unsigned n) { return math::factorial(cpp_int(n)).value(); };
+
+  SECTION("factorial_mod against exact values") {
+    const std::uint64_t p = 1000000007ULL;
+    for (unsigned n : {0u, 1u, 5u, 20u, 100u, 1000u}) {
+      auto r = math::factorial_mod(std::uint64_t{n}, p);
+      REQUIRE(r.has_value());
+      REQUIRE(cpp_int(r.value()) == f(n) % p);
+    }
+    // n >= p: n! contiene el factor p
+    REQUIRE(math::factorial_mod(std::uint32_t{13}, std::uint32_t{13}).value() == 0);
+    // Teorema de Wilson: (p-1)! = -1 (mod p)
+    REQUIRE(math::factorial_mod(p - 1, p).value() == p - 1);
+    REQUIRE(math::factorial_mod(p - 2, p).value() == 1);
+
+    auto r_bad = math::factorial_mod(std::uint32_t{5}, std::uint32_t{1});
+    REQUIRE_FALSE(r_bad.has_value());
+    REQUIRE(r_bad.error() == core::MathError::DomainError);
+  }
+
+  SECTION("combinations_mod and permutations_mod against exact values") {
+    for (std::uint64_t p : {2ULL, 13ULL, 1000000007ULL, 2305843009213693951ULL}) {
+      for (unsigned n = 0; n <= 60; n += 3) {
+        for (unsigned k = 0; k <= n; k += 2) {
+          const cpp_int c = f(n) / (f(k) * f(n - k));
+          const cpp_int perm = f(n) / f(n - k);
+          auto rc = math::combinations_mod(std::uint64_t{n}, std::uint64_t{k}, p);
+          auto rp = math::permutations_mod(std::uint64_t{n}, std::uint64_t{k}, p);
+          REQUIRE(rc.has_value());
+          REQUIRE(rp.has_value());
+          REQUIRE(cpp_int(rc.value()) == c % p);
+          REQUIRE(cpp_int(rp.value()) == perm % p);
+        }
+      }
+    }
+
+    // Lucas con n > p: C(1000, 300) mod 7
+    auto r_lucas = math::combinations_mod(std::uint32_t{1000}, std::uint32_t{300},
+                                          std::uint32_t{7});
+    REQUIRE(r_lucas.has_value());
+    REQUIRE(cpp_int(r_lucas.value()) == (f(1000) / (f(300) * f(700))) % 7);
+
+    auto r_bad = math::combinations_mod(std::uint64_t{3}, std::uint64_t{4},
+                                        std::uint64_t{7});
+    REQUIRE_FALSE(r_bad.has_value());
+    REQUIRE(r_bad.error() == core::MathError::DomainError);
+  }
+
+  SECTION("Factorial tables are cached per modulus") {
+    // Alternar módulos no reconstruye las tablas que siguen en la caché
+    const std::uint64_t p1 = 1000000007ULL;
+    const std::uint64_t p2 = 998244353ULL;
+    const auto *fact1 =
+        math::internal::modular_factorial_table(p1, 1000).fact.data();
+    const auto *fact2 =
+        math::internal::modular_factorial_table(p2, 1000).fact.data();
+    for (int round = 0; round < 3; ++round) {
+      REQUIRE(math::combinations_mod(std::uint64_t{1000}, std::uint64_t{300},
+                                     p1)
+                  .has_value());
+      REQUIRE(math::combinations_mod(std::uint64_t{1000}, std::uint64_t{300},
+                                     p2)
+                  .has_value());
+    }
+    REQUIRE(math::internal::modular_factorial_table(p1, 1000).fact.data() ==
+            fact1);
+    REQUIRE(math::internal::modular_factorial_table(p2, 1000).fact.data() ==
+            fact2);
+
+    // Con la caché llena, un módulo nuevo desplaza al más antiguo
+    for (std::uint64_t p : {13ULL, 17ULL, 19ULL, 23ULL, 29ULL}) {
+      REQUIRE(math::factorial_mod(p - 1, p).value() == p - 1);
+    }
+    // p1 se reconstruye tras ser desplazado
+    REQUIRE(cpp_int(math::factorial_mod(std::uint64_t{1000}, p1).value()) ==
+            f(1000) % p1);
+  }
+
+  SECTION("Arguments beyond the factorial table") {
+    // p = 2^22 - 3 (primo): la referencia es un bucle de productos
+    const std::uint64_t p = 4194301ULL;
+    std::vector<std::uint64_t> fact_ref(p);
+    fact_ref[0] = 1;
+    for (std::uint64_t i = 1; i < p; ++i) {
+      fact_ref[i] = fact_ref[i - 1] * i % p;
+    }
+    const std::uint64_t table = std::uint64_t{1} << 20;
+    // Lado directo (n < p - 1 - n) y lado de Wilson (p - 1 - n < n)
+    for (std::uint64_t n : {table + 10, p / 2, p - 1 - (table + 5), p - 3}) {
+      REQUIRE(math::factorial_mod(n, p).value() == fact_ref[n]);
+    }
+
+    const auto inv = [p](std::uint64_t a) {
+      return math::internal::mod_pow(a, p - 2, p);
+    };
+    for (std::uint64_t k : {std::uint64_t{3}, table + 1, p / 3}) {
+      const std::uint64_t n = p - 2;
+      REQUIRE(math::combinations_mod(n, k, p).value() ==
+              fact_ref[n] * inv(fact_ref[k]) % p * inv(fact_ref[n - k]) % p);
+      REQUIRE(math::permutations_mod(n, k, p).value() ==
+              fact_ref[n] * inv(fact_ref[n - k]) % p);
+    }
+
+    // p = 10^9 + 7: n - k pequeño pasa por r! / (r-k)! y Wilson
+    const std::uint64_t q = 1000000007ULL;
+    REQUIRE(math::permutations_mod(q - 1, q - 3, q).value() == (q - 1) / 2);
+    REQUIRE(math::combinations_mod(q - 1, q - 3, q).value() == 1);
+
+    // Más de MOD_DIRECT_MAX_STEPS productos: error en lugar de bloquearse
+    auto r_big = math::factorial_mod(std::uint64_t{500000000}, q);
+    REQUIRE_FALSE(r_big.has_value());
+    REQUIRE(r_big.error() == core::MathError::Overflow);
+    auto c_big = math::combinations_mod(std::uint64_t{900000000},
+                                        std::uint64_t{450000000}, q);
+    REQUIRE_FALSE(c_big.has_value());
+    REQUIRE(c_big.error() == core::MathError::Overflow);
+  }
+}
@@ -0,0 +1,143 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/math_errors.hpp>
+#include <numbers_calculations/math/factorization.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+using core::MathError;
+
+namespace {
+
+// Los factores son primos, crecientes y su producto reconstruye n.
+template <typename T>
+bool is_factorization_of(const T &n, const math::Factorization<T> &factors) {
+  T product = 1;
+  T previous = 0;
+  for (const auto &f : factors) {
+    if (!math::is_prime(f.prime) || f.prime <= previous || f.exponent == 0) {
+      return false;
+    }
+    previous = f.prime;
+    for (unsigned int i = 0; i < f.exponent; ++i) {
+      product *= f.prime;
+    }
+  }
+  return product == n;
+}
+
+} // namespace
+
+// Evaluación en tiempo de compilación
+static_assert(math::factorize(std::uint64_t{360}).value().size() == 3);
+static_assert(math::factorize(std::uint64_t{360}).value()[0].exponent == 3);
+static_assert(math::factorize(std::uint64_t{1}).value().empty());
+
+TEST_CASE("Integer factorization", "[factorization]") {
+
+  SECTION("Small values and edge cases") {
+    CHECK(math::factorize(std::uint64_t{0}).error() == MathError::DomainError);
+    const auto f360 = math::factorize(std::uint32_t{360}).value();
+    REQUIRE(f360.size() == 3);
+    CHECK(f360[0].prime == 2);
+    CHECK(f360[0].exponent == 3);
+    CHECK(f360[1].prime == 3);
+    CHECK(f360[1].exponent == 2);
+    CHECK(f360[2].prime == 5);
+    CHECK(f360[2].exponent == 1);
+
+    std::uint32_t misses = 0;
+    for (std::uint64_t n = 1; n < 100000; ++n) {
+      misses += !is_factorization_of(n, math::factorize(n).value());
+    }
+    CHECK(misses == 0);
+    CHECK(is_factorization_of(std::uint8_t{255},
+                              math::factorize(std::uint8_t{255}).value()));
+  }
+
+  SECTION("Hard 64-bit values") {
+    const auto fermat = math::factorize(~std::uint64_t{0}).value();
+    CHECK(fermat.size() == 7);
+    CHECK(fermat[6].prime == 6700417);
+    // Primorial de 47: el máximo de primos distintos en 64 bits
+    const std::uint64_t primorial = 614889782588491410ULL;
+    const auto many = math::factorize(primorial).value();
+    CHECK(many.size() == math::Factorization<std::uint64_t>::capacity());
+    CHECK(is_factorization_of(primorial, many));
+
+    constexpr std::uint64_t p = 4294967291ULL; // mayor primo < 2^32
+    constexpr std::uint64_t q = 4294967279ULL;
+    const auto semiprime = math::factorize(p * q).value();
+    REQUIRE(semiprime.size() == 2);
+    CHECK(semiprime[0].prime == q);
+    CHECK(semiprime[1].prime == p);
+    const auto square = math::factorize(p * p).value();
+    REQUIRE(square.size() == 1);
+    CHECK(square[0].exponent == 2);
+    const std::uint64_t power = 65521ULL * 65521 * 65521 * 65521;
+    CHECK(math::factorize(power).value()[0].exponent == 4);
+
+    std::mt19937_64 rng(20);
+    for (int i = 0; i < 3000; ++i) {
+      const std::uint64_t n = rng() >> (rng() % 40);
+      if (n != 0) {
+        CHECK(is_factorization_of(n, math::factorize(n).value()));
+      }
+    }
+  }
+
+  SECTION("128-bit values") {
+    const auto all_ones = math::factorize(~0_ui128).value();
+    CHECK(all_ones.size() == 9); // 3, 5, 17, 257, 641, 65537, ...
+    CHECK(is_factorization_of(~0_ui128, all_ones));
+
+    const core::uint128_t big_prime = (1_ui128 << 89) - 1;
+    const auto mersenne = math::factorize(big_prime * 1000003).value();
+    REQUIRE(mersenne.size() == 2);
+    CHECK(mersenne[1].prime == big_prime);
+
+    std::mt19937_64 rng(2020);
+    for (int i = 0; i < 300; ++i) {
+      // Un factor grande y dos de hasta 32 bits: el rho termina pronto
+      const core::uint128_t n = core::uint128_t{rng() | 1} *
+                                (rng() >> (32 + rng() % 32)) *
+                                ((rng() >> (32 + rng() % 32)) | 1);
+      if (n != 0) {
+        CHECK(is_factorization_of(n, math::factorize(n).value()));
+      }
+    }
+  }
+
+  SECTION("Batch") {
+    std::vector<std::uint64_t> values(4000);
+    std::mt19937_64 rng(200);
+    for (auto &v : values) {
+      v = (rng() >> (16 + rng() % 48)) + 1;
+    }
+    values[17] = 0;
+    std::vector<math::Factorization<std::uint64_t>> out(values.size());
+    std::vector<MathError> status(values.size());
+
+    math::ParallelConfig config;
+    config.thread_count = 4;
+    config.serial_cutoff = 100;
+    CHECK(math::factorize_batch(values.data(), values.size(), out.data(),
+                                status.data(), config) == 1);
+    CHECK(status[17] == MathError::DomainError);
+    CHECK(out[17].empty());
+    std::size_t misses = 0;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      if (values[i] != 0) {
+        misses += status[i] != MathError::NoError ||
+                  !is_factorization_of(values[i], out[i]);
+      }
+    }
+    CHECK(misses == 0);
+  }
+}
@@ -0,0 +1,228 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/math_errors.hpp>
+#include <numbers_calculations/math/gcd.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+using core::MathError;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+// a * x + b * y == g, comprobado en cpp_int
+template <typename T>
+bool is_bezout(const T &a, const T &b, const math::ExtendedGcd<T> &r) {
+  return mp::cpp_int(a) * mp::cpp_int(r.x) + mp::cpp_int(b) * mp::cpp_int(r.y) ==
+         mp::cpp_int(r.gcd);
+}
+
+} // namespace
+
+// Evaluación en tiempo de compilación
+static_assert(math::gcd(std::uint64_t{12}, std::uint64_t{18}).value() == 6);
+static_assert(math::gcd(std::int32_t{-12}, std::int32_t{18}).value() == 6);
+static_assert(math::lcm(std::uint64_t{4}, std::uint64_t{6}).value() == 12);
+static_assert(math::modular_inverse(std::uint64_t{3}, std::uint64_t{11})
+                  .value() == 4);
+static_assert(math::extended_gcd(std::int64_t{240}, std::int64_t{46})
+                  .value()
+                  .x == -9);
+
+TEST_CASE("GCD and LCM", "[gcd]") {
+
+  SECTION("Native types") {
+    CHECK(math::gcd(std::uint64_t{0}, std::uint64_t{0}).value() == 0);
+    CHECK(math::gcd(std::uint64_t{0}, std::uint64_t{7}).value() == 7);
+    CHECK(math::gcd(std::uint64_t{7}, std::uint64_t{0}).value() == 7);
+    CHECK(math::gcd(std::uint64_t{1} << 40, std::uint64_t{3} << 20).value() ==
+          std::uint64_t{1} << 20);
+    CHECK(math::gcd(std::int64_t{-12}, std::int64_t{-18}).value() == 6);
+    constexpr auto i64_min = std::numeric_limits<std::int64_t>::min();
+    CHECK(math::gcd(i64_min, std::int64_t{0}).error() == MathError::Overflow);
+    CHECK(math::gcd(i64_min, std::int64_t{6}).value() == 2);
+    CHECK(math::gcd(std::uint8_t{255}, std::uint8_t{85}).value() == 85);
+    CHECK(math::gcd((1_ui128 << 100) * 3, (1_ui128 << 90) * 9).value() ==
+          (1_ui128 << 90) * 3);
+
+    std::mt19937_64 rng(18);
+    for (int i = 0; i < 5000; ++i) {
+      const std::uint64_t common = rng() >> (rng() % 64);
+      const std::uint64_t a = (rng() >> (rng() % 64)) * (common | 1);
+      const std::uint64_t b = (rng() >> (rng() % 64)) * (common | 1);
+      CHECK(math::gcd(a, b).value() == std::gcd(a, b));
+      const auto sa = static_cast<std::int64_t>(a);
+      const auto sb = static_cast<std::int64_t>(b >> 1);
+      if (sa != std::numeric_limits<std::int64_t>::min()) {
+        CHECK(math::gcd(sa, sb).value() == std::gcd(sa, sb));
+      }
+      const core::uint128_t wa = (core::uint128_t{a} << 64) | b;
+      const core::uint128_t wb = (core::uint128_t{b} << (rng() % 64)) | a;
+      CHECK(mp::cpp_int(math::gcd(wa, wb).value()) ==
+            mp::gcd(mp::cpp_int(wa), mp::cpp_int(wb)));
+    }
+  }
+
+  SECTION("LCM with overflow") {
+    CHECK(math::lcm(std::uint64_t{0}, std::uint64_t{5}).value() == 0);
+    CHECK(math::lcm(std::int64_t{-4}, std::int64_t{6}).value() == 12);
+    CHECK(math::lcm(std::uint64_t{1} << 32, (std::uint64_t{1} << 32) + 1)
+              .error() == MathError::Overflow);
+    CHECK(math::lcm(std::uint64_t{1} << 63, std::uint64_t{1} << 62).value() ==
+          std::uint64_t{1} << 63);
+    CHECK(math::lcm(std::int64_t{1} << 62, std::int64_t{3}).error() ==
+          MathError::Overflow);
+    CHECK(math::lcm(std::uint8_t{15}, std::uint8_t{17}).value() == 255);
+    CHECK(math::lcm(std::uint8_t{16}, std::uint8_t{17}).error() ==
+          MathError::Overflow);
+    const mp::uint128_t big = mp::uint128_t(1) << 100;
+    CHECK(math::lcm(big, mp::uint128_t(big + 1)).error() ==
+          MathError::Overflow);
+  }
+
+  SECTION("Boost types (Lehmer)") {
+    std::mt19937_64 rng(181);
+    const auto random_big = [&rng](int limbs) {
+      mp::cpp_int x = 0;
+      for (int i = 0; i < limbs; ++i) {
+        x = (x << 64) | rng();
+      }
+      return x;
+    };
+    for (int i = 0; i < 200; ++i) {
+      const mp::cpp_int common = random_big(1 + i % 5);
+      const mp::cpp_int a = random_big(1 + i % 17) * common;
+      const mp::cpp_int b = random_big(1 + i % 13) * common;
+      CHECK(math::gcd(a, b).value() == mp::gcd(a, b));
+      CHECK(math::gcd(mp::cpp_int(-a), b).value() == mp::gcd(a, b));
+      CHECK(math::lcm(a, b).value() == mp::lcm(a, b));
+
+      const auto r = math::extended_gcd(a, mp::cpp_int(-b)).value();
+      CHECK(r.gcd == mp::gcd(a, b));
+      CHECK(is_bezout(a, mp::cpp_int(-b), r));
+      CHECK(mp::abs(r.x) <= b / (2 * r.gcd) + 1);
+    }
+    const mp::uint1024_t a = mp::uint1024_t(random_big(15)) * 12345;
+    const mp::uint1024_t b = mp::uint1024_t(random_big(12)) * 12345;
+    CHECK(mp::cpp_int(math::gcd(a, b).value()) ==
+          mp::gcd(mp::cpp_int(a), mp::cpp_int(b)));
+    const auto r = math::extended_gcd(a, b).value();
+    CHECK(mp::cpp_int(a) * r.x + mp::cpp_int(b) * r.y == mp::cpp_int(r.gcd));
+  }
+
+  SECTION("Extended GCD and modular inverse") {
+    const auto r = math::extended_gcd(std::int64_t{240}, std::int64_t{46});
+    CHECK(r.value().gcd == 2);
+    CHECK(r.value().x == -9);
+    CHECK(r.value().y == 47);
+    CHECK(math::extended_gcd(std::int64_t{0}, std::int64_t{0}).value().gcd ==
+          0);
+    const auto zero = math::extended_gcd(std::int64_t{0}, std::int64_t{-5});
+    CHECK(zero.value().gcd == 5);
+    CHECK(is_bezout(std::int64_t{0}, std::int64_t{-5}, zero.value()));
+
+    std::mt19937_64 rng(1818);
+    for (int i = 0; i < 3000; ++i) {
+      const std::uint64_t a = rng() >> (rng() % 64);
+      const std::uint64_t b = rng() >> (rng() % 64);
+      CHECK(is_bezout(a, b, math::extended_gcd(a, b).value()));
+      const auto sa = static_cast<std::int64_t>(a) >> 1;
+      const auto sb = -(static_cast<std::int64_t>(b) >> 1);
+      CHECK(is_bezout(sa, sb, math::extended_gcd(sa, sb).value()));
+      const core::uint128_t wa = (core::uint128_t{a} << 64) | rng();
+      const core::uint128_t wb = core::uint128_t{b} * rng();
+      CHECK(is_bezout(wa, wb, math::extended_gcd(wa, wb).value()));
+    }
+
+    CHECK(math::modular_inverse(std::int64_t{-3}, std::int64_t{11}).value() ==
+          7);
+    CHECK(math::modular_inverse(std::uint64_t{6}, std::uint64_t{9}).error() ==
+          MathError::DomainError);
+    CHECK(math::modular_inverse(std::int64_t{3}, std::int64_t{-7}).error() ==
+          MathError::DomainError);
+    CHECK(math::modular_inverse(std::uint64_t{5}, std::uint64_t{1}).value() ==
+          0);
+    constexpr std::uint64_t p64 = 18446744073709551557ULL; // 2^64 - 59
+    for (std::uint64_t a : {std::uint64_t{2}, p64 - 1, std::uint64_t{1} << 63,
+                            std::uint64_t{123456789}}) {
+      const std::uint64_t inv = math::modular_inverse(a, p64).value();
+      CHECK(static_cast<core::uint128_t>(a) * inv % p64 == 1);
+    }
+    const core::uint128_t p127 = (1_ui128 << 127) - 1;
+    const core::uint128_t inv = math::modular_inverse(3_ui128, p127).value();
+    CHECK(mp::cpp_int(inv) * 3 % mp::cpp_int(p127) == 1);
+
+    const mp::cpp_int m = mp::pow(mp::cpp_int(2), 521) - 1; // primo de Mersenne
+    const mp::cpp_int a = mp::pow(mp::cpp_int(3), 200) + 1;
+    const mp::cpp_int big_inv = math::modular_inverse(a, m).value();
+    CHECK(big_inv * a % m == 1);
+    CHECK(math::modular_inverse(mp::cpp_int(-a), m).value() == m - big_inv);
+  }
+
+  SECTION("Parallel reductions") {
+    math::ParallelConfig config;
+    config.thread_count = 4;
+    config.serial_cutoff = 64;
+
+    std::vector<std::uint64_t> values(10000);
+    std::mt19937_64 rng(42);
+    for (auto &v : values) {
+      v = (rng() >> 44) * 2 * 3 * 7 * 64;
+    }
+    std::uint64_t expected = 0;
+    for (const auto v : values) {
+      expected = std::gcd(expected, v);
+    }
+    CHECK(math::gcd_reduce(values.begin(), values.end(), config).value() ==
+          expected);
+    values[5000] = 13;
+    CHECK(math::gcd_reduce(values.begin(), values.end(), config).value() == 1);
+    CHECK(math::gcd_reduce(values.begin(), values.begin(), config).value() ==
+          0);
+
+    // |min| no cabe en int64_t, pero sólo importa si es el resultado final
+    constexpr auto i64_min = std::numeric_limits<std::int64_t>::min();
+    const std::vector<std::int64_t> with_min = {i64_min, 6};
+    CHECK(math::gcd_reduce(with_min.begin(), with_min.end()).value() == 2);
+    const std::vector<std::int64_t> only_min = {i64_min, i64_min};
+    CHECK(math::gcd_reduce(only_min.begin(), only_min.end()).error() ==
+          MathError::Overflow);
+    std::vector<std::int64_t> signed_values(10000, i64_min);
+    CHECK(math::gcd_reduce(signed_values.begin(), signed_values.end(), config)
+              .error() == MathError::Overflow);
+    for (std::size_t i = 0; i < signed_values.size(); i += 7) {
+      signed_values[i] = -static_cast<std::int64_t>(values[i] | 1) * 1024;
+    }
+    // Varios bloques empiezan por min y otros por múltiplos impares de 2^10
+    CHECK(math::gcd_reduce(signed_values.begin(), signed_values.end(), config)
+              .value() == 1024);
+
+    std::vector<std::uint64_t> small(20);
+    std::iota(small.begin(), small.end(), 1);
+    CHECK(math::lcm_reduce(small.begin(), small.end(), config).value() ==
+          232792560);
+    CHECK(math::lcm_reduce(small.begin(), small.begin(), config).value() == 1);
+    CHECK(math::lcm_reduce(values.begin(), values.end(), config).error() ==
+          MathError::Overflow);
+    values[9999] = 0;
+    CHECK(math::lcm_reduce(values.begin(), values.end(), config).value() == 0);
+
+    std::vector<mp::cpp_int> big(3000);
+    for (std::size_t i = 0; i < big.size(); ++i) {
+      big[i] = mp::cpp_int(i + 1) * mp::pow(mp::cpp_int(6), 40);
+    }
+    CHECK(math::gcd_reduce(big.begin(), big.end(), config).value() ==
+          mp::pow(mp::cpp_int(6), 40));
+    std::vector<mp::cpp_int> primes_lcm = {4, 6, 10, 14};
+    CHECK(math::lcm_reduce(primes_lcm.begin(), primes_lcm.end()).value() ==
+          420);
+  }
+}
@@ -0,0 +1,335 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/math_errors.hpp>
+#include <numbers_calculations/math/integer_ops.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+using core::MathError;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+// Compara integer_power<Exp>(base) con integer_power(base, Exp) para
+// Exp = 0 .. sizeof...(E) - 1.
+template <typename T, std::size_t... E>
+void check_fixed_exponents(T base, std::index_sequence<E...>) {
+  (
+      [&] {
+        const auto fixed = math::integer_power<E>(base);
+        const auto runtime = math::integer_power(base, std::uint64_t{E});
+        INFO("base = " << static_cast<long long>(base) << ", exp = " << E);
+        REQUIRE(fixed.has_value() == runtime.has_value());
+        if (fixed) {
+          REQUIRE(*fixed == *runtime);
+        }
+      }(),
+      ...);
+}
+
+} // namespace
+
+TEST_CASE("Integer operations", "[integer_ops]") {
+
+  SECTION("integer_power with runtime exponent") {
+    CHECK(math::integer_power(2, 10u).value() == 1024);
+    CHECK(math::integer_power(7, 5u).value() == 16807);
+    CHECK(math::integer_power(10_ui128, 38u).value() ==
+          100000000000000000000000000000000000000_ui128);
+    CHECK(math::integer_power(10_ui128, 39u).error() == MathError::Overflow);
+    CHECK(math::integer_power(2_ui128, 128u).error() == MathError::Overflow);
+    // Los valores de las LUTs se comprueban contra el tipo de la base
+    CHECK(math::integer_power(std::uint32_t{2}, 32u).error() ==
+          MathError::Overflow);
+    CHECK(math::integer_power(std::int8_t{3}, 5u).error() ==
+          MathError::Overflow);
+    CHECK(math::integer_power(-7, 11u).value() == -1977326743);
+    CHECK(math::integer_power(-7, 12u).error() == MathError::Overflow);
+  }
+
+  SECTION("integer_power<Exp> with compile-time addition chains") {
+    CHECK(math::integer_power<7>(3).value() == 2187);
+    CHECK(math::integer_power<0>(0).value() == 1);
+    CHECK(math::integer_power<63>(std::uint64_t{2}).value() ==
+          9223372036854775808ULL);
+    CHECK(math::integer_power<64>(std::uint64_t{2}).error() ==
+          MathError::Overflow);
+    CHECK(math::integer_power<3>(-5).value() == -125);
+    CHECK(math::integer_power<31>(-2).value() ==
+          std::numeric_limits<int>::min());
+    CHECK(math::integer_power<31>(2).error() == MathError::Overflow);
+    CHECK(math::integer_power<39>(std::int64_t{-3}).value() ==
+          -4052555153018976267LL);
+    CHECK(math::integer_power<40>(std::int64_t{-3}).error() ==
+          MathError::Overflow);
+    static_assert(*math::integer_power<15>(std::uint64_t{3}) == 14348907);
+
+    // Cadenas óptimas (longitudes conocidas de l(n))
+    static_assert(math::internal::ADDITION_CHAIN<15>.length == 5);
+    static_assert(math::internal::ADDITION_CHAIN<127>.length == 10);
+
+    check_fixed_exponents(std::uint64_t{3}, std::make_index_sequence<45>{});
+    check_fixed_exponents(std::uint64_t{7}, std::make_index_sequence<25>{});
+    check_fixed_exponents(std::int64_t{-3}, std::make_index_sequence<45>{});
+    check_fixed_exponents(std::uint32_t{10}, std::make_index_sequence<12>{});
+    check_fixed_exponents(13_ui128, std::make_index_sequence<40>{});
+  }
+
+  SECTION("integer_power<Exp> with Boost types") {
+    CHECK(math::integer_power<100>(mp::cpp_int(3)).value() ==
+          mp::pow(mp::cpp_int(3), 100));
+    CHECK(math::integer_power<1000>(mp::cpp_int(7)).value() ==
+          mp::pow(mp::cpp_int(7), 1000));
+    CHECK(math::integer_power<101>(mp::cpp_int(-3)).value() ==
+          mp::pow(mp::cpp_int(-3), 101));
+    CHECK(math::integer_power<255>(mp::uint256_t(2)).value() ==
+          mp::pow(mp::uint256_t(2), 255));
+    CHECK(math::integer_power<256>(mp::uint256_t(2)).error() ==
+          MathError::Overflow);
+    CHECK(math::integer_power<161>(mp::int1024_t(-81)).value() ==
+          mp::pow(mp::int1024_t(-81), 161));
+  }
+
+  SECTION("integer_log2 / integer_log10 / integer_log") {
+    CHECK(math::integer_log2(1u).value() == 0);
+    CHECK(math::integer_log2(1023u).value() == 9);
+    CHECK(math::integer_log2(1024u).value() == 10);
+    CHECK(math::integer_log2(0u).error() == MathError::DomainError);
+    CHECK(math::integer_log2(1_ui128 << 100).value() == 100);
+    CHECK(math::integer_log10(999).value() == 2);
+    CHECK(math::integer_log10(1000).value() == 3);
+    CHECK(math::integer_log10(0).error() == MathError::DomainError);
+    CHECK(math::integer_log10(std::uint8_t{255}).value() == 2);
+    CHECK(math::integer_log10(-5).error() == MathError::DomainError);
+    CHECK(math::integer_log10(mp::cpp_int(1) << 200).value() == 60);
+    CHECK(math::integer_log(3, 81).value() == 4);
+    CHECK(math::integer_log(2, 1024).value() == 10);
+    CHECK(math::integer_log(1, 5).error() == MathError::DomainError);
+  }
+
+  SECTION("integer_log10 / decimal_digits around every power of ten") {
+    // Referencia: división repetida
+    const auto naive_log10 = [](core::uint128_t n) {
+      unsigned int log = 0;
+      while (n >= 10) {
+        n /= 10;
+        ++log;
+      }
+      return log;
+    };
+
+    core::uint128_t power = 1;
+    for (unsigned int e = 0; e <= 38; ++e, power *= 10) {
+      for (const core::uint128_t n : {power - 1, power, power + 1}) {
+        if (n == 0) {
+          continue;
+        }
+        const unsigned int expected = naive_log10(n);
+        INFO("e = " << e);
+        CHECK(math::integer_log10(n).value() == expected);
+        CHECK(math::decimal_digits(n) == expected + 1);
+        if (n <= std::numeric_limits<std::uint64_t>::max()) {
+          CHECK(math::integer_log10(static_cast<std::uint64_t>(n)).value() ==
+                expected);
+        }
+        if (n <= std::numeric_limits<std::int64_t>::max()) {
+          CHECK(math::integer_log10(static_cast<std::int64_t>(n)).value() ==
+                expected);
+        }
+        if (n <= std::numeric_limits<std::uint32_t>::max()) {
+          CHECK(math::integer_log10(static_cast<std::uint32_t>(n)).value() ==
+                expected);
+        }
+      }
+    }
+    // Todas las anchuras en bits (extremos 2^w - 1 y 2^w)
+    for (unsigned int w = 1; w < 128; ++w) {
+      const core::uint128_t top = (core::uint128_t{1} << w) - 1;
+      CHECK(math::integer_log10(top).value() == naive_log10(top));
+      CHECK(math::integer_log10(top + 1).value() == naive_log10(top + 1));
+    }
+    CHECK(math::integer_log10(std::numeric_limits<core::uint128_t>::max())
+              .value() == 38);
+
+    CHECK(math::decimal_digits(0) == 1);
+    CHECK(math::decimal_digits(-100) == 3);
+    CHECK(math::decimal_digits(std::numeric_limits<std::int64_t>::min()) ==
+          19);
+    CHECK(math::decimal_digits(std::numeric_limits<std::uint64_t>::max()) ==
+          20);
+    CHECK(math::decimal_digits(std::numeric_limits<core::int128_t>::min()) ==
+          39);
+    CHECK(math::decimal_digits(mp::cpp_int(-mp::pow(mp::cpp_int(10), 100))) ==
+          101);
+    static_assert(math::decimal_digits(std::uint16_t{65535}) == 5);
+  }
+
+  SECTION("integer_log with arbitrary bases") {
+    // Referencia: división repetida
+    const auto naive_log = [](auto base, auto n) {
+      unsigned int log = 0;
+      while (n >= base) {
+        n /= base;
+        ++log;
+      }
+      return log;
+    };
+
+    // Alrededor de cada potencia de cada base (más bases que entradas
+    // tiene la caché, para forzar reemplazos)
+    for (std::uint64_t base = 3; base < 40; ++base) {
+      if (base == 10) {
+        continue;
+      }
+      core::uint128_t power = 1;
+      while (true) {
+        for (const core::uint128_t n : {power - 1, power, power + 1}) {
+          if (n == 0) {
+            continue;
+          }
+          INFO("base = " << base);
+          CHECK(math::integer_log(base, n).value() == naive_log(base, n));
+        }
+        if (power > std::numeric_limits<core::uint128_t>::max() / base) {
+          break;
+        }
+        power *= base;
+      }
+    }
+    CHECK(math::integer_log(7, std::numeric_limits<core::uint128_t>::max())
+              .value() == 45);
+    CHECK(math::integer_log(3, std::numeric_limits<std::uint64_t>::max())
+              .value() == 40);
+    CHECK(math::integer_log(7, std::int64_t{48}).value() == 1);
+    CHECK(math::integer_log(7, std::int64_t{49}).value() == 2);
+    CHECK(math::integer_log(1000003, 5).value() == 0);
+    // base más ancha que n: no se trunca al convertirla al tipo de n
+    CHECK(math::internal::generic_log(1000, std::uint8_t{200}).value() == 0);
+    CHECK(math::internal::generic_log(std::uint64_t{1} << 40, std::int32_t{7})
+              .value() == 0);
+    // (2^64 - 1)^2 = 2^128 - 2^65 + 1 todavía cabe
+    CHECK(math::integer_log(std::numeric_limits<std::uint64_t>::max(),
+                            std::numeric_limits<core::uint128_t>::max())
+              .value() == 2);
+    CHECK(math::integer_log(std::numeric_limits<core::uint128_t>::max(),
+                            std::numeric_limits<core::uint128_t>::max())
+              .value() == 1);
+    CHECK(math::integer_log(7, 0).error() == MathError::DomainError);
+    static_assert(*math::integer_log(7, 2401) == 4);
+
+    // Tipos de Boost (escalera de cuadrados)
+    const mp::cpp_int p7 = mp::pow(mp::cpp_int(7), 5000);
+    CHECK(math::integer_log(7, p7).value() == 5000);
+    CHECK(math::integer_log(7, mp::cpp_int(p7 - 1)).value() == 4999);
+    CHECK(math::integer_log(7, mp::cpp_int(p7 * 6)).value() == 5000);
+    CHECK(math::integer_log(12345, p7).value() ==
+          naive_log(mp::cpp_int(12345), p7));
+    const mp::uint256_t max256 = std::numeric_limits<mp::uint256_t>::max();
+    CHECK(math::integer_log(3, max256).value() ==
+          naive_log(mp::uint256_t(3), max256));
+    CHECK(math::integer_log(mp::cpp_int(mp::cpp_int(1) << 70), p7).value() ==
+          naive_log(mp::cpp_int(mp::cpp_int(1) << 70), p7));
+  }
+
+  SECTION("integer_log caches are per thread") {
+    std::vector<std::thread> workers;
+    std::vector<int> failures(4, 0);
+    for (int t = 0; t < 4; ++t) {
+      workers.emplace_back([t, &failures] {
+        for (std::uint64_t base = 3 + t; base < 200; base += 4) {
+          core::uint128_t power = 1;
+          unsigned int e = 0;
+          while (power <= std::numeric_limits<core::uint128_t>::max() / base) {
+            power *= base;
+            ++e;
+            if (math::integer_log(base, power).value() != e ||
+                math::integer_log(base, power - 1).value() != e - 1) {
+              ++failures[t];
+            }
+          }
+        }
+      });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    CHECK(failures == std::vector<int>(4, 0));
+  }
+
+  SECTION("Boost fast paths") {
+    // log2 por msb
+    CHECK(math::integer_log2(mp::uint256_t(1) << 255).value() == 255);
+    CHECK(math::integer_log2(mp::uint1024_t(12345)).value() == 13);
+    CHECK(math::integer_log(2, mp::cpp_int(1) << 100000).value() == 100000);
+    CHECK(math::integer_log(2, mp::cpp_int((mp::cpp_int(1) << 777) - 1))
+              .value() == 776);
+
+    // log10 por estimación + una comparación
+    const mp::cpp_int p10 = mp::pow(mp::cpp_int(10), 3000);
+    CHECK(math::integer_log10(p10).value() == 3000);
+    CHECK(math::integer_log10(mp::cpp_int(p10 - 1)).value() == 2999);
+    CHECK(math::integer_log10(mp::cpp_int(p10 * 9)).value() == 3000);
+    CHECK(math::decimal_digits(p10) == 3001);
+    CHECK(math::integer_log10(std::numeric_limits<mp::uint512_t>::max())
+              .value() == 154);
+
+    // Potencias de bases pares por desplazamiento
+    CHECK(math::integer_power(mp::cpp_int(2), 1000u).value() ==
+          mp::cpp_int(1) << 1000);
+    CHECK(math::integer_power(mp::cpp_int(10), 200u).value() ==
+          mp::pow(mp::cpp_int(10), 200));
+    CHECK(math::integer_power(mp::cpp_int(-12), 51u).value() ==
+          mp::pow(mp::cpp_int(-12), 51));
+    CHECK(math::integer_power(mp::cpp_int(3), 500u).value() ==
+          mp::pow(mp::cpp_int(3), 500));
+    CHECK(math::integer_power(mp::uint256_t(2), 255u).value() ==
+          mp::uint256_t(1) << 255);
+    CHECK(math::integer_power(mp::uint256_t(2), 256u).error() ==
+          MathError::Overflow);
+    CHECK(math::integer_power(mp::uint256_t(6), 99u).value() ==
+          mp::pow(mp::uint256_t(6), 99));
+    CHECK(math::integer_power(mp::uint256_t(6), 100u).error() ==
+          MathError::Overflow);
+    CHECK(math::integer_power(mp::int256_t(-2), 255u).value() ==
+          -(mp::int256_t(1) << 255));
+    CHECK(math::integer_power(mp::int256_t(7), 91u).value() ==
+          mp::pow(mp::int256_t(7), 91));
+    CHECK(math::integer_power(mp::int256_t(7), 92u).error() ==
+          MathError::Overflow);
+  }
+
+  SECTION("Sliding-window exponentiation for Boost types") {
+    // Contra la exponenciación binaria, en todos los tamaños de ventana
+    const mp::cpp_int base("123456789012345678901234567890123");
+    for (const std::uint64_t e :
+         {1u, 2u, 3u, 5u, 6u, 7u, 31u, 63u, 64u, 65u, 100u, 255u, 256u, 500u,
+          1023u, 1500u}) {
+      INFO("e = " << e);
+      CHECK(math::internal::sliding_window_power(base, e).value() ==
+            math::internal::generic_power(base, e).value());
+      CHECK(math::integer_power(mp::cpp_int(-base), e).value() ==
+            mp::pow(mp::cpp_int(-base), static_cast<unsigned>(e)));
+    }
+    for (std::uint64_t e = 0; e < 300; ++e) {
+      CHECK(math::integer_power(mp::cpp_int(7), e).value() ==
+            mp::pow(mp::cpp_int(7), static_cast<unsigned>(e)));
+    }
+
+    // Overflow en tipos acotados: 3^161 < 2^256 < 3^162
+    CHECK(math::integer_power(mp::uint256_t(3), 161u).value() ==
+          mp::pow(mp::uint256_t(3), 161));
+    CHECK(math::integer_power(mp::uint256_t(3), 162u).error() ==
+          MathError::Overflow);
+    const mp::uint1024_t big = (mp::uint1024_t(1) << 100) + 1;
+    CHECK(math::integer_power(big, 10u).value() == mp::pow(big, 10));
+    CHECK(math::integer_power(big, 11u).error() == MathError::Overflow);
+    CHECK(math::integer_power(mp::cpp_int(-1), ~std::uint64_t{0}).value() ==
+          -1);
+  }
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/math_errors.hpp>
+#include <numbers_calculations/math/integer_roots.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+using core::MathError;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+// Comprueba r = floor(n^(1/k)) con la definición: r^k <= n < (r+1)^k
+template <typename T> bool is_floor_root(const T &n, unsigned k, const T &r) {
+  const mp::cpp_int big_n(n);
+  const mp::cpp_int big_r(r);
+  return mp::pow(big_r, k) <= big_n && mp::pow(big_r + 1, k) > big_n;
+}
+
+} // namespace
+
+// Evaluación en tiempo de compilación (Newton entero)
+static_assert(math::integer_sqrt(std::uint64_t{99}).value() == 9);
+static_assert(math::integer_sqrt(std::numeric_limits<std::uint64_t>::max())
+                  .value() == 0xFFFFFFFFULL);
+static_assert(math::integer_cbrt(std::int64_t{-28}).value() == -3);
+static_assert(math::integer_nth_root(std::uint64_t{1} << 60, 5u).value() ==
+              4096);
+static_assert(math::integer_sqrt(~0_ui128).value() == ~std::uint64_t{0});
+static_assert(math::is_perfect_power(std::uint64_t{1} << 35));
+static_assert(!math::is_perfect_power(std::uint64_t{12}));
+
+TEST_CASE("Integer roots", "[integer_roots]") {
+
+  SECTION("Domain and small values") {
+    CHECK(math::integer_nth_root(std::uint64_t{8}, 0u).error() ==
+          MathError::DomainError);
+    CHECK(math::integer_sqrt(std::int64_t{-4}).error() ==
+          MathError::DomainError);
+    CHECK(math::integer_sqrt(std::uint64_t{0}).value() == 0);
+    CHECK(math::integer_sqrt(std::uint64_t{1}).value() == 1);
+    CHECK(math::integer_sqrt(std::uint64_t{3}).value() == 1);
+    CHECK(math::integer_sqrt(std::uint64_t{4}).value() == 2);
+    CHECK(math::integer_cbrt(std::uint32_t{26}).value() == 2);
+    CHECK(math::integer_cbrt(std::uint32_t{27}).value() == 3);
+    CHECK(math::integer_cbrt(std::int32_t{-27}).value() == -3);
+    CHECK(math::integer_nth_root(std::uint64_t{1000}, 1u).value() == 1000);
+    CHECK(math::integer_nth_root(std::uint64_t{1000}, 3u).value() == 10);
+    CHECK(math::integer_nth_root(std::uint64_t{999}, 3u).value() == 9);
+    CHECK(math::integer_nth_root(~std::uint64_t{0}, 64u).value() == 1);
+    CHECK(math::integer_nth_root(~std::uint64_t{0}, 63u).value() == 2);
+    CHECK(math::integer_nth_root(std::uint8_t{255}, 2u).value() == 15);
+    CHECK(math::integer_cbrt(std::numeric_limits<std::int64_t>::min())
+              .value() == -2097152);
+  }
+
+  SECTION("Boundaries around perfect squares and cubes (uint64_t)") {
+    for (std::uint64_t r : {std::uint64_t{3037000499}, std::uint64_t{94906265},
+                            std::uint64_t{4294967295}, std::uint64_t{1} << 31}) {
+      const std::uint64_t sq = r * r;
+      CHECK(math::integer_sqrt(sq).value() == r);
+      CHECK(math::integer_sqrt(sq - 1).value() == r - 1);
+      CHECK(math::integer_sqrt(sq + 1).value() == r);
+    }
+    constexpr std::uint64_t c = 2642245; // floor(cbrt(2^64 - 1))
+    CHECK(math::integer_cbrt(c * c * c).value() == c);
+    CHECK(math::integer_cbrt(c * c * c - 1).value() == c - 1);
+    CHECK(math::integer_cbrt(~std::uint64_t{0}).value() == c);
+  }
+
+  SECTION("Random native values against the definition") {
+    std::mt19937_64 rng(17);
+    for (int i = 0; i < 2000; ++i) {
+      const std::uint64_t n = rng() >> (rng() % 64);
+      const unsigned k = 2 + static_cast<unsigned>(rng() % 10);
+      CHECK(is_floor_root(n, k, math::integer_nth_root(n, k).value()));
+
+      const core::uint128_t wide =
+          ((core::uint128_t{rng()} << 64) | rng()) >> (rng() % 128);
+      CHECK(is_floor_root(wide, 2, math::integer_sqrt(wide).value()));
+      CHECK(is_floor_root(wide, 3, math::integer_cbrt(wide).value()));
+      CHECK(is_floor_root(wide, k, math::integer_nth_root(wide, k).value()));
+    }
+    // Cuadrados perfectos de 128 bits (donde el double no basta)
+    for (int i = 0; i < 200; ++i) {
+      const core::uint128_t r = core::uint128_t{rng()} | 1;
+      CHECK(math::integer_sqrt(r * r).value() == r);
+      CHECK(math::integer_sqrt(r * r - 1).value() == r - 1);
+    }
+  }
+
+  SECTION("Boost types") {
+    const mp::cpp_int big = mp::pow(mp::cpp_int(3), 1001) + 12345;
+    for (unsigned k : {2u, 3u, 7u, 64u, 1000u, 1587u, 2000u}) {
+      CHECK(is_floor_root(big, k, math::integer_nth_root(big, k).value()));
+    }
+    const mp::cpp_int root = mp::pow(mp::cpp_int(10), 150) + 7;
+    CHECK(math::integer_sqrt(mp::cpp_int(root * root)).value() == root);
+    CHECK(math::integer_sqrt(mp::cpp_int(root * root - 1)).value() ==
+          root - 1);
+    CHECK(math::integer_cbrt(mp::cpp_int(-root * root * root)).value() ==
+          -root);
+    CHECK(math::integer_sqrt(mp::cpp_int(-1)).error() ==
+          MathError::DomainError);
+
+    const mp::uint1024_t max1024 = std::numeric_limits<mp::uint1024_t>::max();
+    CHECK(is_floor_root(max1024, 2, math::integer_sqrt(max1024).value()));
+    CHECK(is_floor_root(max1024, 5, math::integer_nth_root(max1024, 5u).value()));
+  }
+
+  SECTION("Perfect powers") {
+    CHECK(math::is_perfect_power(std::uint64_t{0}));
+    CHECK(math::is_perfect_power(std::uint64_t{1}));
+    CHECK(math::is_perfect_power(std::int64_t{-1}));
+    CHECK(math::is_perfect_power(std::uint64_t{1024}));
+    CHECK(math::is_perfect_power(std::uint64_t{1000}));
+    CHECK(math::is_perfect_power(std::uint64_t{6} * 6 * 6 * 6 * 6 * 6 * 6));
+    CHECK_FALSE(math::is_perfect_power(std::uint64_t{2}));
+    CHECK_FALSE(math::is_perfect_power(std::uint64_t{12}));
+    CHECK_FALSE(math::is_perfect_power(std::uint64_t{1000001}));
+    CHECK(math::is_perfect_power(std::int64_t{-8}));
+    CHECK_FALSE(math::is_perfect_power(std::int64_t{-4}));
+    CHECK(math::is_perfect_power(std::int64_t{-64})); // (-4)^3
+    CHECK(math::is_perfect_power(std::numeric_limits<std::int64_t>::min()));
+    CHECK(math::is_perfect_power(
+        math::integer_power(3_ui128, 80u).value()));
+    CHECK_FALSE(math::is_perfect_power(
+        math::integer_power(3_ui128, 80u).value() + 2));
+    CHECK(math::is_perfect_power(std::uint64_t{4294967291} * 4294967291ULL));
+    CHECK_FALSE(math::is_perfect_power(~std::uint64_t{0}));
+
+    const mp::cpp_int big = mp::pow(mp::cpp_int(12345), 97);
+    CHECK(math::is_perfect_power(big));
+    CHECK_FALSE(math::is_perfect_power(mp::cpp_int(big + 1)));
+    CHECK(math::is_perfect_power(mp::cpp_int(-big)));
+    CHECK_FALSE(math::is_perfect_power(
+        mp::cpp_int(-mp::pow(mp::cpp_int(12345), 2))));
+
+    // Comparación exhaustiva con la definición para n < 2^16
+    std::uint32_t misses = 0;
+    for (std::uint32_t n = 2; n < (1u << 16); ++n) {
+      bool expected = false;
+      for (std::uint32_t b = 2; b * b <= n && !expected; ++b) {
+        std::uint64_t p = b * b;
+        while (p < n) {
+          p *= b;
+        }
+        expected = p == n;
+      }
+      misses += math::is_perfect_power(n) != expected;
+    }
+    CHECK(misses == 0);
+  }
+}
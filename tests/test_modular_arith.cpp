@@ -0,0 +1,129 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/math_errors.hpp>
+#include <numbers_calculations/math/modular_arith.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+using core::MathError;
+using math::ModularMethod;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+// Referencia: powm de Boost sobre cpp_int
+template <typename T, typename T_Exp>
+T reference_power_mod(T base, T_Exp exp, T m) {
+  const mp::cpp_int result = mp::powm(mp::cpp_int(base), mp::cpp_int(exp),
+                                      mp::cpp_int(m));
+  return static_cast<T>(result);
+}
+
+// power_mod con los tres métodos (todos deben coincidir)
+template <typename T, typename T_Exp>
+void check_all_methods(T base, T_Exp exp, T m) {
+  const T expected = reference_power_mod(base, exp, m);
+  CHECK(math::power_mod(base, exp, m).value() == expected);
+  CHECK(math::power_mod(base, exp, m, ModularMethod::Montgomery).value() ==
+        expected);
+  CHECK(math::power_mod(base, exp, m, ModularMethod::Barrett).value() ==
+        expected);
+}
+
+} // namespace
+
+// Evaluación en tiempo de compilación
+static_assert(math::power_mod(std::uint64_t{2}, 10u, std::uint64_t{1000})
+                  .value() == 24);
+static_assert(math::power_mod(std::uint64_t{3}, 1000000006u,
+                              std::uint64_t{1000000007})
+                  .value() == 1);
+static_assert(math::power_mod(2_ui128, 127u, (1_ui128 << 127) - 1).value() ==
+              1);
+static_assert(math::power_mod(std::uint64_t{7}, 5u, std::uint64_t{1024},
+                              ModularMethod::Barrett)
+                  .value() == 16807 % 1024);
+
+TEST_CASE("Modular arithmetic", "[modular_arith]") {
+
+  SECTION("Domain and edge cases") {
+    CHECK(math::power_mod(std::uint64_t{5}, 3u, std::uint64_t{0}).error() ==
+          MathError::DomainError);
+    CHECK(math::mul_mod(std::uint64_t{5}, std::uint64_t{3}, std::uint64_t{0})
+              .error() == MathError::DomainError);
+    CHECK(math::power_mod(std::uint64_t{5}, 3u, std::uint64_t{1}).value() ==
+          0);
+    CHECK(math::power_mod(123_ui128, 0u, 1_ui128).value() == 0);
+    CHECK(math::power_mod(std::uint64_t{0}, 0u, std::uint64_t{7}).value() ==
+          1);
+    CHECK(math::power_mod(std::uint64_t{0}, 5u, std::uint64_t{7}).value() ==
+          0);
+    CHECK(math::power_mod(std::uint32_t{3}, 4u, std::uint32_t{5}).value() ==
+          1);
+    CHECK(math::power_mod(std::uint8_t{200}, 3u, std::uint8_t{251}).value() ==
+          reference_power_mod<std::uint8_t>(200, 3u, 251));
+  }
+
+  SECTION("mul_mod") {
+    constexpr auto u64_max = std::numeric_limits<std::uint64_t>::max();
+    CHECK(math::mul_mod(u64_max, u64_max, u64_max - 58).value() == 3364);
+    const core::uint128_t m = (1_ui128 << 127) - 1;
+    const core::uint128_t a = (1_ui128 << 126) + 12345;
+    CHECK(math::mul_mod(a, a, m).value() ==
+          static_cast<core::uint128_t>(mp::cpp_int(a) * a % m));
+  }
+
+  SECTION("Fermat with 64 and 128-bit primes") {
+    constexpr std::uint64_t p64 = 18446744073709551557ULL; // 2^64 - 59
+    const core::uint128_t p128 = (1_ui128 << 127) - 1;      // Mersenne
+    for (std::uint64_t a : {std::uint64_t{2}, std::uint64_t{3},
+                            std::uint64_t{1234567}, p64 - 1}) {
+      CHECK(math::power_mod(a, p64 - 1, p64).value() == 1);
+      CHECK(math::power_mod(core::uint128_t{a}, p128 - 1, p128).value() == 1);
+    }
+  }
+
+  SECTION("Random 64-bit moduli against cpp_int") {
+    std::mt19937_64 rng(16);
+    for (int i = 0; i < 500; ++i) {
+      std::uint64_t m = rng() >> (rng() % 63);
+      if (m < 2) {
+        m = 2;
+      }
+      check_all_methods(rng(), rng(), m);
+      check_all_methods(rng(), rng(), m | 1);
+    }
+    // Módulos en el borde de 2^64
+    constexpr auto u64_max = std::numeric_limits<std::uint64_t>::max();
+    constexpr std::uint64_t top_bit = std::uint64_t{1} << 63;
+    for (std::uint64_t m : {u64_max, u64_max - 1, top_bit, top_bit + 1}) {
+      check_all_methods(u64_max - 3, u64_max, m);
+    }
+  }
+
+  SECTION("Random 128-bit moduli against cpp_int") {
+    std::mt19937_64 rng(128);
+    const auto random_u128 = [&rng] {
+      return (core::uint128_t{rng()} << 64) | rng();
+    };
+    for (int i = 0; i < 300; ++i) {
+      core::uint128_t m = random_u128() >> (rng() % 127);
+      if (m < 2) {
+        m = 2;
+      }
+      check_all_methods(random_u128(), random_u128(), m);
+      check_all_methods(random_u128(), rng(), m | 1);
+    }
+    const core::uint128_t u128_max = ~0_ui128;
+    for (core::uint128_t m : {u128_max, u128_max - 1, 1_ui128 << 127,
+                              (1_ui128 << 64) + 1, 1_ui128 << 64}) {
+      check_all_methods(u128_max - 3, u128_max, m);
+    }
+  }
+}
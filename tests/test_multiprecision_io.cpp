@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/multiprecision_io.hpp>
+
+using namespace numbers_calculations;
+using core::int128_t;
+using core::MathError;
+using core::uint128_t;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+std::string random_digits(std::mt19937_64 &rng, std::size_t count) {
+  std::string digits(1, static_cast<char>('1' + rng() % 9));
+  while (digits.size() < count) {
+    digits += static_cast<char>('0' + rng() % 10);
+  }
+  return digits;
+}
+
+} // namespace
+
+TEST_CASE("Multiprecision decimal conversion", "[multiprecision_io]") {
+  constexpr std::size_t leaf = core::internal::RADIX_LEAF_DIGITS;
+
+  SECTION("to_string and from_string agree with Boost around every split") {
+    std::mt19937_64 rng(25);
+    for (const std::size_t digits :
+         {std::size_t{1}, std::size_t{9}, std::size_t{10}, leaf - 1, leaf,
+          leaf + 1, 2 * leaf, 2 * leaf + 1, 4 * leaf - 1, 4 * leaf,
+          9 * leaf + 5, std::size_t{40000}}) {
+      for (const std::string &text :
+           {random_digits(rng, digits), "1" + std::string(digits - 1, '0'),
+            std::string(digits, '9')}) {
+        const mp::cpp_int expected(text);
+        CHECK(core::to_string(expected) == text);
+        CHECK(core::to_string(mp::cpp_int(-expected)) == "-" + text);
+        const auto parsed = core::from_string<mp::cpp_int>(text);
+        REQUIRE(parsed.has_value());
+        CHECK(*parsed == expected);
+      }
+    }
+    // Cifras cero entre hojas y bloques de 9
+    const mp::cpp_int sparse = (mp::cpp_int(1) << 20000) + 1;
+    CHECK(core::to_string(sparse) == sparse.str());
+    CHECK(*core::from_string<mp::cpp_int>(sparse.str()) == sparse);
+    CHECK(core::to_string(mp::cpp_int(0)) == "0");
+  }
+
+  SECTION("to_chars writes into a caller buffer") {
+    const mp::cpp_int value = mp::cpp_int(1) << 100;
+    char buffer[32];
+    const auto result = core::to_chars(buffer, buffer + sizeof(buffer), value);
+    CHECK(result.ec == std::errc{});
+    CHECK(std::string(buffer, result.ptr) == "1267650600228229401496703205376");
+
+    // Cota holgada (32 > 31 cifras) pero hueco justo: usa el buffer auxiliar
+    const auto exact = core::to_chars(buffer, buffer + 31, value);
+    CHECK(exact.ec == std::errc{});
+    CHECK(exact.ptr == buffer + 31);
+    const auto small = core::to_chars(buffer, buffer + 30, value);
+    CHECK(small.ec == std::errc::value_too_large);
+    CHECK(small.ptr == buffer + 30);
+  }
+
+  SECTION("from_chars follows std::from_chars") {
+    const std::string text = "-0012x";
+    mp::int256_t value = 5;
+    auto result = core::from_chars(text.data(), text.data() + text.size(),
+                                   value);
+    CHECK(result.ec == std::errc{});
+    CHECK(result.ptr == text.data() + 5);
+    CHECK(value == -12);
+
+    mp::uint256_t unsigned_value = 5;
+    result = core::from_chars(text.data(), text.data() + text.size(),
+                              unsigned_value);
+    CHECK(result.ec == std::errc::invalid_argument);
+    CHECK(result.ptr == text.data());
+    CHECK(unsigned_value == 5);
+
+    const std::string octal_looking = "0777";
+    mp::cpp_int big;
+    core::from_chars(octal_looking.data(),
+                     octal_looking.data() + octal_looking.size(), big);
+    CHECK(big == 777);
+  }
+
+  SECTION("Fixed-width Boost types reject out-of-range values") {
+    const mp::int256_t max = std::numeric_limits<mp::int256_t>::max();
+    const mp::int256_t min = std::numeric_limits<mp::int256_t>::min();
+    CHECK(*core::from_string<mp::int256_t>(core::to_string(max)) == max);
+    CHECK(*core::from_string<mp::int256_t>(core::to_string(min)) == min);
+    CHECK(core::from_string<mp::int256_t>(
+              core::to_string(mp::cpp_int(max) + 1))
+              .error() == MathError::Overflow);
+
+    const mp::uint1024_t umax = std::numeric_limits<mp::uint1024_t>::max();
+    CHECK(core::to_string(umax) == umax.str());
+    CHECK(*core::from_string<mp::uint1024_t>(umax.str()) == umax);
+    CHECK(core::from_string<mp::uint1024_t>(
+              core::to_string(mp::cpp_int(umax) + 1))
+              .error() == MathError::Overflow);
+    CHECK(core::from_string<mp::uint1024_t>(std::string(400, '9')).error() ==
+          MathError::Overflow);
+  }
+
+  SECTION("Native and 128-bit types") {
+    CHECK(core::to_string(-42) == "-42");
+    CHECK(core::to_string(std::uint8_t{255}) == "255");
+    CHECK(core::to_string(std::numeric_limits<uint128_t>::max()) ==
+          "340282366920938463463374607431768211455");
+    CHECK(core::to_string(std::numeric_limits<int128_t>::min()) ==
+          "-170141183460469231731687303715884105728");
+
+    CHECK(*core::from_string<int>("+17") == 17);
+    CHECK(*core::from_string<int128_t>("-5") == -5);
+    CHECK(core::from_string<std::uint8_t>("256").error() ==
+          MathError::Overflow);
+    CHECK(core::from_string<uint128_t>(
+              "340282366920938463463374607431768211456")
+              .error() == MathError::Overflow);
+  }
+
+  SECTION("from_string rejects malformed text") {
+    for (const char *text : {"", "+", "-", "+-1", "12ab", " 1", "1 "}) {
+      CHECK(core::from_string<int>(text).error() == MathError::DomainError);
+      CHECK(core::from_string<mp::cpp_int>(text).error() ==
+            MathError::DomainError);
+    }
+  }
+}
@@ -0,0 +1,218 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/core/numeric_io.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+using core::int128_t;
+using core::uint128_t;
+using core::operator<<;
+using core::operator>>;
+
+namespace {
+
+// Referencia: cifra a cifra, como el formateador original.
+std::string reference_string(uint128_t v) {
+  std::string s;
+  do {
+    s.insert(s.begin(), static_cast<char>('0' + static_cast<int>(v % 10)));
+    v /= 10;
+  } while (v != 0);
+  return s;
+}
+
+template <typename T> std::string format(T v) {
+  char buffer[64];
+  const auto result = core::to_chars(buffer, buffer + sizeof(buffer), v);
+  REQUIRE(result.ec == std::errc{});
+  return std::string(buffer, result.ptr);
+}
+
+template <typename T> bool parses_to(const std::string &s, T expected) {
+  T value = 0;
+  const auto result = core::from_chars(s.data(), s.data() + s.size(), value);
+  return result.ec == std::errc{} && result.ptr == s.data() + s.size() &&
+         value == expected;
+}
+
+} // namespace
+
+TEST_CASE("128-bit decimal conversion", "[numeric_io]") {
+  constexpr uint128_t u_max = std::numeric_limits<uint128_t>::max();
+  constexpr int128_t i_min = std::numeric_limits<int128_t>::min();
+  constexpr int128_t i_max = std::numeric_limits<int128_t>::max();
+
+  SECTION("to_chars at chunk boundaries") {
+    CHECK(format(uint128_t{0}) == "0");
+    CHECK(format(uint128_t{9}) == "9");
+    CHECK(format(uint128_t{10}) == "10");
+    CHECK(format(uint128_t{100}) == "100");
+    CHECK(format(uint128_t{9999999999999999999ULL}) == "9999999999999999999");
+    CHECK(format(uint128_t{10000000000000000000ULL}) ==
+          "10000000000000000000");
+    CHECK(format(uint128_t{std::numeric_limits<std::uint64_t>::max()}) ==
+          "18446744073709551615");
+    CHECK(format(uint128_t{1} << 64) == "18446744073709551616");
+    CHECK(format(10000000000000000000_ui128 * 10000000000000000000ULL) ==
+          "100000000000000000000000000000000000000");
+    CHECK(format(u_max) == "340282366920938463463374607431768211455");
+    CHECK(format(i_min) == "-170141183460469231731687303715884105728");
+    CHECK(format(i_max) == "170141183460469231731687303715884105727");
+    CHECK(format(int128_t{-1}) == "-1");
+
+    std::mt19937_64 rng(22);
+    for (int i = 0; i < 20000; ++i) {
+      const uint128_t v = ((uint128_t{rng()} << 64) | rng()) >> (rng() % 128);
+      REQUIRE(format(v) == reference_string(v));
+    }
+  }
+
+  SECTION("to_chars reports a buffer that is too small") {
+    char buffer[39];
+    auto result = core::to_chars(buffer, buffer + 38, u_max);
+    CHECK(result.ec == std::errc::value_too_large);
+    CHECK(result.ptr == buffer + 38);
+    result = core::to_chars(buffer, buffer + 39, u_max);
+    CHECK(result.ec == std::errc{});
+    CHECK(result.ptr == buffer + 39);
+    CHECK(core::to_chars(buffer, buffer, int128_t{-5}).ec ==
+          std::errc::value_too_large);
+    CHECK(core::to_chars(buffer, buffer + 1, int128_t{-5}).ec ==
+          std::errc::value_too_large);
+  }
+
+  SECTION("from_chars round trips and limits") {
+    CHECK(parses_to("0", uint128_t{0}));
+    CHECK(parses_to("000000000000000000000000000000000000000000042",
+                    uint128_t{42}));
+    CHECK(parses_to("340282366920938463463374607431768211455", u_max));
+    CHECK(parses_to("-170141183460469231731687303715884105728", i_min));
+    CHECK(parses_to("170141183460469231731687303715884105727", i_max));
+    CHECK(parses_to("-0", int128_t{0}));
+
+    std::mt19937_64 rng(2022);
+    for (int i = 0; i < 20000; ++i) {
+      const uint128_t v = ((uint128_t{rng()} << 64) | rng()) >> (rng() % 128);
+      REQUIRE(parses_to(reference_string(v), v));
+      const auto s = static_cast<int128_t>(v);
+      REQUIRE(parses_to(format(s), s));
+    }
+  }
+
+  SECTION("from_chars errors leave the value untouched") {
+    uint128_t u = 7;
+    const std::string too_big = "340282366920938463463374607431768211456";
+    auto result = core::from_chars(too_big.data(),
+                                   too_big.data() + too_big.size(), u);
+    CHECK(result.ec == std::errc::result_out_of_range);
+    CHECK(result.ptr == too_big.data() + too_big.size());
+    CHECK(u == 7);
+    const std::string forty = "1000000000000000000000000000000000000000x";
+    result = core::from_chars(forty.data(), forty.data() + forty.size(), u);
+    CHECK(result.ec == std::errc::result_out_of_range);
+    CHECK(*result.ptr == 'x');
+
+    int128_t s = 7;
+    const std::string below_min = "-170141183460469231731687303715884105729";
+    CHECK(core::from_chars(below_min.data(),
+                           below_min.data() + below_min.size(), s)
+              .ec == std::errc::result_out_of_range);
+    CHECK(s == 7);
+
+    for (const char *text : {"", "-", "+1", " 1", "x1"}) {
+      const auto end = text + std::strlen(text);
+      const auto r = core::from_chars(text, end, s);
+      CHECK(r.ec == std::errc::invalid_argument);
+      CHECK(r.ptr == text);
+    }
+    const char *negative = "-5";
+    CHECK(core::from_chars(negative, negative + 2, u).ec ==
+          std::errc::invalid_argument);
+
+    const char *prefix = "123abc";
+    result = core::from_chars(prefix, prefix + 6, u);
+    CHECK(result.ec == std::errc{});
+    CHECK(result.ptr == prefix + 3);
+    CHECK(u == 123);
+  }
+
+  SECTION("from_chars finds the end of every digit run") {
+    // Cada longitud y cada byte "casi cifra" en cada posición de los
+    // bloques de 8 y 16 caracteres
+    for (std::size_t length = 1; length <= 39; ++length) {
+      std::string digits;
+      for (std::size_t i = 0; i < length; ++i) {
+        digits += static_cast<char>('1' + i % 9);
+      }
+      const uint128_t expected = [&] {
+        uint128_t v = 0;
+        for (const char c : digits) {
+          v = v * 10 + static_cast<unsigned>(c - '0');
+        }
+        return v;
+      }();
+      for (const char stop : {'/', ':', ' ', '\xFF', '\0', 'a'}) {
+        const std::string text = digits + stop + "99999999999999999";
+        uint128_t value = 0;
+        const auto r = core::from_chars(text.data(),
+                                        text.data() + text.size(), value);
+        REQUIRE(r.ec == std::errc{});
+        REQUIRE(r.ptr == text.data() + length);
+        REQUIRE(value == expected);
+      }
+    }
+    std::string zeros(100, '0');
+    CHECK(parses_to(zeros, uint128_t{0}));
+    CHECK(parses_to(zeros + "340282366920938463463374607431768211455", u_max));
+  }
+
+  SECTION("Stream operators") {
+    std::ostringstream out;
+    out << u_max << ' ' << i_min << ' ' << uint128_t{0};
+    CHECK(out.str() == "340282366920938463463374607431768211455 "
+                       "-170141183460469231731687303715884105728 0");
+    std::ostringstream padded;
+    padded.width(6);
+    padded.fill('*');
+    padded << int128_t{-42};
+    CHECK(padded.str() == "***-42");
+
+    std::istringstream in("-170141183460469231731687303715884105728 +17 12ab");
+    int128_t value = 0;
+    in >> value;
+    CHECK(value == i_min);
+    in >> value;
+    CHECK(value == 17);
+    in >> value;
+    CHECK(in.fail());
+    CHECK(value == 17);
+
+    std::istringstream unsigned_in(
+        "340282366920938463463374607431768211455 +8 -1");
+    uint128_t u = 0;
+    unsigned_in >> u;
+    CHECK(u == u_max);
+    unsigned_in >> u;
+    CHECK(u == 8);
+    unsigned_in >> u;
+    CHECK(unsigned_in.fail());
+    CHECK(u == 8);
+
+    std::istringstream overflow("170141183460469231731687303715884105728");
+    overflow >> value;
+    CHECK(overflow.fail());
+    std::istringstream sign_only("+-1");
+    sign_only >> value;
+    CHECK(sign_only.fail());
+  }
+}
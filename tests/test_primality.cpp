@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <numbers_calculations/core/constexpr_literals.hpp>
+#include <numbers_calculations/core/extended_type_traits.hpp>
+#include <numbers_calculations/math/primality.hpp>
+
+using namespace numbers_calculations;
+using namespace numbers_calculations::core::literals;
+namespace mp = boost::multiprecision;
+
+namespace {
+
+bool is_prime_by_division(std::uint64_t n) {
+  if (n < 2) {
+    return false;
+  }
+  for (std::uint64_t d = 2; d * d <= n; ++d) {
+    if (n % d == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+// Evaluación en tiempo de compilación
+static_assert(math::is_prime(2));
+static_assert(!math::is_prime(561));
+static_assert(math::is_prime(std::uint64_t{18446744073709551557ULL}));
+static_assert(math::is_prime((1_ui128 << 127) - 1));
+
+TEST_CASE("Primality", "[primality]") {
+
+  SECTION("Small values against trial division") {
+    std::uint32_t misses = 0;
+    for (std::uint64_t n = 0; n < 200000; ++n) {
+      misses += math::is_prime(n) != is_prime_by_division(n);
+    }
+    CHECK(misses == 0);
+    CHECK_FALSE(math::is_prime(-7));
+    CHECK_FALSE(math::is_prime(std::numeric_limits<std::int64_t>::min()));
+    CHECK(math::is_prime(std::uint8_t{251}));
+    CHECK(math::is_prime(std::numeric_limits<std::int32_t>::max()));
+  }
+
+  SECTION("Pseudoprimes") {
+    // Carmichael y pseudoprimos fuertes de las bases de Jaeschke/Sinclair
+    for (std::uint64_t n :
+         {std::uint64_t{561}, std::uint64_t{2047}, std::uint64_t{1373653},
+          std::uint64_t{25326001}, std::uint64_t{3215031751},
+          std::uint64_t{4759123141}, std::uint64_t{2152302898747},
+          std::uint64_t{3474749660383}, std::uint64_t{341550071728321},
+          std::uint64_t{3825123056546413051}}) {
+      CHECK_FALSE(math::is_prime(n));
+    }
+    // Cuadrados de primos y semiprimos grandes
+    constexpr std::uint64_t p = 4294967291ULL; // mayor primo < 2^32
+    CHECK_FALSE(math::is_prime(p * p));
+    const core::uint128_t q = 18446744073709551557ULL; // mayor primo < 2^64
+    const core::uint128_t r = 18446744073709551533ULL;
+    CHECK(math::is_prime(q));
+    CHECK_FALSE(math::is_prime(q * q));
+    CHECK_FALSE(math::is_prime(q * r));
+    CHECK_FALSE(math::is_prime(~0_ui128));
+    CHECK(math::is_prime((1_ui128 << 89) - 1));
+    CHECK_FALSE(math::is_prime((1_ui128 << 67) - 1)); // 193707721 * 761838257287
+  }
+
+  SECTION("Strong Lucas test") {
+    // Pseudoprimos fuertes de Lucas (Selfridge) < 10^5: OEIS A217255
+    const std::array<std::uint64_t, 12> lucas_pseudoprimes = {
+        5459,  5777,  10877, 16109, 18971, 22499,
+        24569, 25199, 40309, 58519, 75077, 97439};
+    std::vector<std::uint64_t> found;
+    for (std::uint64_t n = 15; n < 100000; n += 2) {
+      std::uint64_t root = 1;
+      while (root * root < n) {
+        ++root;
+      }
+      if (root * root == n) {
+        continue;
+      }
+      const bool lucas = math::internal::is_strong_lucas_probable_prime(
+          math::internal::MontgomeryContext<std::uint64_t>(n));
+      CHECK(lucas == math::internal::is_strong_lucas_probable_prime(
+                         math::internal::MontgomeryContext<core::uint128_t>(n)));
+      if (lucas && !is_prime_by_division(n)) {
+        found.push_back(n);
+      }
+    }
+    CHECK(found == std::vector<std::uint64_t>(lucas_pseudoprimes.begin(),
+                                              lucas_pseudoprimes.end()));
+  }
+
+  SECTION("Random values against Boost") {
+    std::mt19937_64 rng(19);
+    for (int i = 0; i < 20000; ++i) {
+      const std::uint64_t n = (rng() >> (rng() % 62)) | 1;
+      CHECK(math::is_prime(n) == mp::miller_rabin_test(mp::cpp_int(n), 25));
+    }
+    for (int i = 0; i < 3000; ++i) {
+      const core::uint128_t n =
+          (((core::uint128_t{rng()} << 64) | rng()) >> (rng() % 60)) | 1;
+      CHECK(math::is_prime(n) == mp::miller_rabin_test(mp::cpp_int(n), 25));
+    }
+  }
+
+  SECTION("Batch") {
+    std::vector<std::uint64_t> values(50000);
+    std::mt19937_64 rng(190);
+    for (auto &v : values) {
+      v = rng() >> (rng() % 64);
+    }
+    std::vector<char> storage(values.size());
+    bool *out = reinterpret_cast<bool *>(storage.data());
+
+    math::ParallelConfig config;
+    config.thread_count = 4;
+    config.serial_cutoff = 1000;
+    const std::size_t primes =
+        math::is_prime_batch(values.data(), values.size(), out, config);
+    std::size_t expected = 0;
+    std::size_t misses = 0;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      expected += math::is_prime(values[i]);
+      misses += out[i] != math::is_prime(values[i]);
+    }
+    CHECK(primes == expected);
+    CHECK(misses == 0);
+    CHECK(math::is_prime_batch(values.data(), 0, out) == 0);
+  }
+}
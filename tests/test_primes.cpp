@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <numbers_calculations/core/math_errors.hpp>
+#include <numbers_calculations/math/internal/prime_sieve.hpp>
+#include <numbers_calculations/math/primality.hpp>
+#include <numbers_calculations/math/primes.hpp>
+
+using namespace numbers_calculations;
+using core::MathError;
+
+namespace {
+
+std::vector<std::uint64_t> collect(std::uint64_t lo, std::uint64_t hi) {
+  std::vector<std::uint64_t> primes;
+  auto range = math::primes_in(lo, hi).value();
+  for (const std::uint64_t p : range) {
+    primes.push_back(p);
+  }
+  return primes;
+}
+
+std::vector<std::uint64_t> by_is_prime(std::uint64_t lo, std::uint64_t hi) {
+  std::vector<std::uint64_t> primes;
+  for (std::uint64_t n = lo; n <= hi; ++n) {
+    if (math::is_prime(n)) {
+      primes.push_back(n);
+    }
+  }
+  return primes;
+}
+
+} // namespace
+
+TEST_CASE("Segmented sieve", "[primes]") {
+
+  SECTION("prime_count against known values of pi(n)") {
+    math::ParallelConfig config;
+    config.thread_count = 4;
+    config.serial_cutoff = 1000;
+    CHECK(math::prime_count(0).value() == 0);
+    CHECK(math::prime_count(1).value() == 0);
+    CHECK(math::prime_count(2).value() == 1);
+    CHECK(math::prime_count(3).value() == 2);
+    CHECK(math::prime_count(13).value() == 6);
+    CHECK(math::prime_count(100, config).value() == 25);
+    CHECK(math::prime_count(15015 * 2 + 1, config).value() == 3248);
+    CHECK(math::prime_count(1000000, config).value() == 78498);
+    CHECK(math::prime_count(10000000, config).value() == 664579);
+    CHECK(math::prime_count(100000000, config).value() == 5761455);
+    CHECK(math::prime_count(math::SEGMENTED_SIEVE_MAX_LIMIT + 1).error() ==
+          MathError::Overflow);
+  }
+
+  SECTION("prime_count does not depend on the thread split") {
+    const std::uint64_t n = 3 * math::internal::SIEVE_SEGMENT_BITS * 2 + 12345;
+    const std::uint64_t expected = math::prime_count(n).value();
+    for (unsigned threads : {1u, 2u, 3u, 7u}) {
+      math::ParallelConfig config;
+      config.thread_count = threads;
+      config.serial_cutoff = 1;
+      config.chunks_per_thread = 5;
+      CHECK(math::prime_count(n, config).value() == expected);
+    }
+  }
+
+  SECTION("primes_in against is_prime") {
+    CHECK(collect(10, 30) ==
+          std::vector<std::uint64_t>{11, 13, 17, 19, 23, 29});
+    CHECK(collect(0, 13) ==
+          std::vector<std::uint64_t>{2, 3, 5, 7, 11, 13});
+    CHECK(collect(2, 2) == std::vector<std::uint64_t>{2});
+    CHECK(collect(24, 28).empty());
+    CHECK(collect(30, 10).empty());
+    CHECK(math::primes_in(0, math::SEGMENTED_SIEVE_MAX_LIMIT + 1).error() ==
+          MathError::Overflow);
+
+    // Tramo que cruza varios segmentos
+    const std::uint64_t span = 2 * math::internal::SIEVE_SEGMENT_BITS;
+    CHECK(collect(span - 1000, 3 * span + 1000) ==
+          by_is_prime(span - 1000, 3 * span + 1000));
+    // Tramos altos: los primos base llegan hasta sqrt(hi)
+    constexpr std::uint64_t high = 1000000000000ULL;
+    CHECK(collect(high, high + 100) ==
+          std::vector<std::uint64_t>{1000000000039ULL, 1000000000061ULL,
+                                     1000000000063ULL, 1000000000091ULL});
+    CHECK(collect(high * 1000, high * 1000 + 20000) ==
+          by_is_prime(high * 1000, high * 1000 + 20000));
+  }
+
+  SECTION("Iterator protocol") {
+    auto range = math::primes_in(100, 200).value();
+    auto it = range.begin();
+    CHECK(*it == 101);
+    CHECK(range.begin() == it); // begin() no reinicia ni avanza
+    ++it;
+    CHECK(*it == 103);
+    std::uint64_t count = 2;
+    for (++it; it != range.end(); ++it) {
+      ++count;
+    }
+    CHECK(count == 21);
+  }
+
+  SECTION("sieve_primes uses the segmented sieve for large limits") {
+    for (std::uint32_t limit :
+         {math::internal::SEGMENTED_SIEVE_THRESHOLD,
+          math::internal::SEGMENTED_SIEVE_THRESHOLD + 7, 3000017u}) {
+      CHECK(math::internal::sieve_primes(limit) ==
+            math::internal::simple_sieve_primes(limit));
+    }
+  }
+}